@@ -4,19 +4,12 @@
 #include "Individual.h"
 #include "Utils.h"
 
+// its speed and vision grow after the first meal, see SpeciesRegistry
 class Ascendant : public Individual {
-    bool hasEaten;
-
 public:
-    Ascendant(int x, int y);
-    [[nodiscard]] sf::Color getOwnColor() const override;
-    [[nodiscard]] int getHunger() const override;
-    void eat() override;
-    [[nodiscard]] int getVision() const override;
-    [[nodiscard]] int getSpeed() const override;
-    // override copy constructor, assignment operator
-    Ascendant(const Ascendant &other);
-    Ascendant& operator=(const Ascendant &other);
+    const static IndividualType TYPE = ASCENDANT_TYPE;
+
+    Ascendant(EntityStore &store, EntityStore::Id id);
 };
 
 
@@ -0,0 +1,26 @@
+#ifndef OOP_BOARDSNAPSHOT_H
+#define OOP_BOARDSNAPSHOT_H
+
+#include <array>
+#include <optional>
+#include <vector>
+#include "Color.h"
+#include "EpochStatistics.h"
+#include "PhaseTimers.h"
+
+// what a viewer needs to draw one moment of the simulation, detached from the entities so that it can be read on another thread
+struct BoardSnapshot {
+    int width = 0;
+    int height = 0;
+    // color of every cell in reading order, black for empty cells
+    std::vector<Color> colors;
+    int epoch = 0;
+    int tick = 0;
+    // set once the epoch has ended, until the next generation is spawned
+    std::optional<EpochStatistics> statistics;
+    bool isGameOver = false;
+    // percentiles of the simulation's phases, all empty unless the simulation times them
+    std::array<PhaseStatistics, TICK_PHASE_END> phaseTimes{};
+};
+
+#endif //OOP_BOARDSNAPSHOT_H
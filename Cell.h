@@ -1,15 +1,25 @@
-
 #ifndef OOP_CELL_H
 #define OOP_CELL_H
 
 
-#include <SFML/Graphics/Color.hpp>
+#include "Color.h"
+
+enum CellKind {
+    FOOD_KIND,
+    INDIVIDUAL_KIND
+};
 
 class Cell {
 public:
     const static int CELL_SIZE = 3;
-    [[nodiscard]] virtual sf::Color getColor() const = 0;
+    explicit Cell(CellKind kind) : kind(kind) {}
+    [[nodiscard]] virtual Color getColor() const = 0;
+    // tag used instead of RTTI to tell what a cell holds
+    [[nodiscard]] CellKind getKind() const { return kind; }
     virtual ~Cell() = default;
+
+private:
+    CellKind kind;
 };
 
 
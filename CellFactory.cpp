@@ -1,4 +1,5 @@
 #include "Utils.h"
+#include "Random.h"
 #include "Individual.h"
 #include "Ascendant.h"
 #include "Suitor.h"
@@ -9,58 +10,118 @@
 #include "Exceptions.h"
 
 
-std::shared_ptr<Ascendant> CellFactory::createAscendant(int x, int y) {
-    return std::make_shared<Ascendant>(x, y);
+// every individual that is not a suitor picks a fighting strategy at random
+EntityStore::Id CellFactory::spawn(EntityStore &store, int x, int y, IndividualType type) {
+    const auto &fighters = store.getFighting().getFighters();
+    auto strategy = fighters[randomIntegerFromInterval(0, (int) fighters.size() - 1)];
+    return store.createIndividual(x, y, type, strategy, randomIntegerFromInterval(0, NUMBERS_OF_DIRECTIONS - 1));
 }
 
-std::shared_ptr<RedBull> CellFactory::createRedBull(int x, int y) {
-    return std::make_shared<RedBull>(x, y);
+Ascendant *CellFactory::createAscendant(EntityStore &store, int x, int y) {
+    return store.attachView<Ascendant>(spawn(store, x, y, ASCENDANT_TYPE));
 }
 
-std::shared_ptr<Keystone> CellFactory::createKeystone(int x, int y) {
-    return std::make_shared<Keystone>(x, y);
+RedBull *CellFactory::createRedBull(EntityStore &store, int x, int y) {
+    return store.attachView<RedBull>(spawn(store, x, y, REDBULL_TYPE));
 }
 
-std::shared_ptr<Clairvoyant> CellFactory::createClairvoyant(int x, int y) {
-    return std::make_shared<Clairvoyant>(x, y);
+Keystone *CellFactory::createKeystone(EntityStore &store, int x, int y) {
+    return store.attachView<Keystone>(spawn(store, x, y, KEYSTONE_TYPE));
 }
 
-std::shared_ptr<Food> CellFactory::createFood(int x, int y) {
-    return std::make_shared<Food>(x, y);
+Clairvoyant *CellFactory::createClairvoyant(EntityStore &store, int x, int y) {
+    return store.attachView<Clairvoyant>(spawn(store, x, y, CLAIRVOYANT_TYPE));
 }
 
-std::shared_ptr<Individual> CellFactory::createSuitor(int x, int y) {
-    switch (randomIntegerFromInterval(0, 3)) {
-        case 0:
-            return std::make_shared<Suitor<Ascendant>>(x, y);
-        case 1:
-            return std::make_shared<Suitor<RedBull>>(x, y);
-        case 2:
-            return std::make_shared<Suitor<Keystone>>(x, y);
-        case 3:
-            return std::make_shared<Suitor<Clairvoyant>>(x, y);
+Individual *CellFactory::createSuitor(EntityStore &store, int x, int y) {
+    const auto &fighters = store.getSpecies().getFighters();
+    return createSuitor(store, x, y, fighters[randomIntegerFromInterval(0, (int) fighters.size() - 1)]);
+}
+
+Individual *CellFactory::createSuitor(EntityStore &store, int x, int y, IndividualType target, IndividualType species) {
+    if (species != SUITOR_TYPE || target >= INDIVIDUAL_TYPE_END) {
+        auto id = store.createIndividual(x, y, species, LOVER_TYPE, randomIntegerFromInterval(0, NUMBERS_OF_DIRECTIONS - 1), target);
+        return store.attachView<Individual>(id);
+    }
+    switch (target) {
+        case ASCENDANT_TYPE:
+            return createSuitor<Ascendant>(store, x, y);
+        case REDBULL_TYPE:
+            return createSuitor<RedBull>(store, x, y);
+        case KEYSTONE_TYPE:
+            return createSuitor<Keystone>(store, x, y);
+        case CLAIRVOYANT_TYPE:
+            return createSuitor<Clairvoyant>(store, x, y);
         default:
-            return nullptr;
+            throw InvalidIndividualTypeException(target);
+    }
+}
+
+Individual *CellFactory::createRegistered(EntityStore &store, int x, int y, IndividualType type) {
+    const Species &species = store.getSpecies()[type];
+    if (!species.isSuitor()) {
+        return store.attachView<Individual>(spawn(store, x, y, type));
     }
+    IndividualType target = species.mates;
+    if (target == SpeciesRegistry::ANY_MATE) {
+        const auto &fighters = store.getSpecies().getFighters();
+        target = fighters[randomIntegerFromInterval(0, (int) fighters.size() - 1)];
+    }
+    return createSuitor(store, x, y, target, type);
 }
 
-std::shared_ptr<Individual> CellFactory::createIndividual(int x, int y, IndividualType type) {
+Individual *CellFactory::createIndividual(EntityStore &store, int x, int y, IndividualType type) {
     switch (type) {
         case ASCENDANT_TYPE:
-            return createAscendant(x, y);
+            return createAscendant(store, x, y);
         case KEYSTONE_TYPE:
-            return createKeystone(x, y);
+            return createKeystone(store, x, y);
         case REDBULL_TYPE:
-            return createRedBull(x, y);
+            return createRedBull(store, x, y);
         case CLAIRVOYANT_TYPE:
-            return createClairvoyant(x, y);
+            return createClairvoyant(store, x, y);
         case SUITOR_TYPE:
-            return createSuitor(x, y);
+            return createSuitor(store, x, y);
         case INDIVIDUAL_TYPE_BEGIN:
             throw InvalidIndividualTypeException(INDIVIDUAL_TYPE_BEGIN);
-        case INDIVIDUAL_TYPE_END:
-            throw InvalidIndividualTypeException(INDIVIDUAL_TYPE_END);
         default:
+            if (type >= INDIVIDUAL_TYPE_END && type < store.getSpecies().end()) {
+                return createRegistered(store, x, y, type);
+            }
             throw InvalidIndividualTypeException(type);
     }
 }
+
+Individual *CellFactory::attachView(EntityStore &store, EntityStore::Id id) {
+    switch (store.species(id)) {
+        case ASCENDANT_TYPE:
+            return store.attachView<Ascendant>(id);
+        case KEYSTONE_TYPE:
+            return store.attachView<Keystone>(id);
+        case REDBULL_TYPE:
+            return store.attachView<RedBull>(id);
+        case CLAIRVOYANT_TYPE:
+            return store.attachView<Clairvoyant>(id);
+        case SUITOR_TYPE:
+            switch (store.mateTarget(id)) {
+                case ASCENDANT_TYPE:
+                    return store.attachView<Suitor<Ascendant>>(id);
+                case REDBULL_TYPE:
+                    return store.attachView<Suitor<RedBull>>(id);
+                case KEYSTONE_TYPE:
+                    return store.attachView<Suitor<Keystone>>(id);
+                case CLAIRVOYANT_TYPE:
+                    return store.attachView<Suitor<Clairvoyant>>(id);
+                default:
+                    if (store.mateTarget(id) >= INDIVIDUAL_TYPE_END && store.mateTarget(id) < store.getSpecies().end()) {
+                        return store.attachView<Individual>(id);
+                    }
+                    throw InvalidIndividualTypeException(store.mateTarget(id));
+            }
+        default:
+            if (store.species(id) >= INDIVIDUAL_TYPE_END && store.species(id) < store.getSpecies().end()) {
+                return store.attachView<Individual>(id);
+            }
+            throw InvalidIndividualTypeException(store.species(id));
+    }
+}
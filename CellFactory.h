@@ -7,31 +7,43 @@
 
 
 #include "Individual.h"
+#include "EntityStore.h"
 #include "Utils.h"
+#include "Random.h"
 #include "Ascendant.h"
 #include "Suitor.h"
 #include "RedBull.h"
 #include "Keystone.h"
 #include "Clairvoyant.h"
 
+// creates entities in an EntityStore and returns their views, which belong to the store
 class CellFactory {
 public:
-    static std::shared_ptr<Ascendant> createAscendant(int x, int y);
-    static std::shared_ptr<RedBull> createRedBull(int x, int y);
-    static std::shared_ptr<Keystone> createKeystone(int x, int y);
-    static std::shared_ptr<Clairvoyant> createClairvoyant(int x, int y);
-    static std::shared_ptr<Individual> createIndividual(int x, int y, IndividualType type);
-    template<typename IndividualType>
-    static std::shared_ptr<Suitor<IndividualType>> createSuitor(int x, int y);
-
-    static std::shared_ptr<Individual> createSuitor(int x, int y);
-
-    static std::shared_ptr<Food> createFood(int x, int y);
+    static Ascendant *createAscendant(EntityStore &store, int x, int y);
+    static RedBull *createRedBull(EntityStore &store, int x, int y);
+    static Keystone *createKeystone(EntityStore &store, int x, int y);
+    static Clairvoyant *createClairvoyant(EntityStore &store, int x, int y);
+    static Individual *createIndividual(EntityStore &store, int x, int y, IndividualType type);
+    template<typename Species>
+    static Suitor<Species> *createSuitor(EntityStore &store, int x, int y);
+
+    // suitor courting a random species among those that fight
+    static Individual *createSuitor(EntityStore &store, int x, int y);
+    // suitor of the given species courting target, the built-in suitors picked through a switch on the tag
+    static Individual *createSuitor(EntityStore &store, int x, int y, IndividualType target, IndividualType species = SUITOR_TYPE);
+    // view of an entity already in the store, such as one loaded from a checkpoint, picked from its species and mate target
+    static Individual *attachView(EntityStore &store, EntityStore::Id id);
+
+private:
+    static EntityStore::Id spawn(EntityStore &store, int x, int y, IndividualType type);
+    // an individual of a species read from a species file, which has no class of its own
+    static Individual *createRegistered(EntityStore &store, int x, int y, IndividualType type);
 };
 
-template <typename IndividualType>
-std::shared_ptr<Suitor<IndividualType>> CellFactory::createSuitor(int x, int y) {
-    return std::make_shared<Suitor<IndividualType>>(x, y);
+template <typename Species>
+Suitor<Species> *CellFactory::createSuitor(EntityStore &store, int x, int y) {
+    auto id = store.createIndividual(x, y, SUITOR_TYPE, LOVER_TYPE, randomIntegerFromInterval(0, NUMBERS_OF_DIRECTIONS - 1), Suitor<Species>::TARGET);
+    return store.attachView<Suitor<Species>>(id);
 }
 
 
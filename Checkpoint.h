@@ -0,0 +1,109 @@
+#ifndef OOP_CHECKPOINT_H
+#define OOP_CHECKPOINT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Exceptions.h"
+
+// binary layout of a saved simulation: the magic number and the format version, then plain values and arrays
+// every array is its element count as a 64-bit number followed by the raw elements, padded to 8 bytes,
+// so that every field stays aligned and the file can be mapped and read in place
+// the numbers are stored in the byte order of the machine that wrote them
+class Checkpoint {
+public:
+    constexpr static std::uint64_t MAGIC = 0x54504B4345504F4FULL; // "OOPECKPT" read as little-endian
+    constexpr static std::uint32_t VERSION = 3;
+    constexpr static std::size_t ALIGNMENT = 8;
+};
+
+class CheckpointWriter {
+public:
+    explicit CheckpointWriter(std::ostream &os) : os(os) {}
+
+    template <typename T>
+    void value(const T &value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write(&value, sizeof(T));
+    }
+
+    template <typename T>
+    void array(const std::vector<T> &values) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        value((std::uint64_t) values.size());
+        write(values.data(), values.size() * sizeof(T));
+    }
+
+private:
+    std::ostream &os;
+    std::size_t offset = 0;
+
+    void write(const void *data, std::size_t bytes) {
+        os.write(static_cast<const char *>(data), (std::streamsize) bytes);
+        offset += bytes;
+        const char padding[Checkpoint::ALIGNMENT] = {};
+        std::size_t rest = (Checkpoint::ALIGNMENT - offset % Checkpoint::ALIGNMENT) % Checkpoint::ALIGNMENT;
+        os.write(padding, (std::streamsize) rest);
+        offset += rest;
+    }
+};
+
+// throws InvalidCheckpointException when the stream ends early or an array is larger than allowed
+class CheckpointReader {
+public:
+    explicit CheckpointReader(std::istream &is) : is(is) {
+        // the size of a file bounds every array in it; a stream that cannot seek is only bounded by the callers
+        auto start = is.tellg();
+        if (start != std::istream::pos_type(-1)) {
+            if (is.seekg(0, std::ios::end)) {
+                bytesLeft = (std::uint64_t) (is.tellg() - start);
+            }
+            is.clear();
+            is.seekg(start);
+        }
+    }
+
+    template <typename T>
+    T value() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value;
+        read(&value, sizeof(T));
+        return value;
+    }
+
+    // maxSize and the bytes left in the file guard against allocating whatever a damaged length asks for
+    template <typename T>
+    void array(std::vector<T> &values, std::uint64_t maxSize) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        auto size = value<std::uint64_t>();
+        if (size > maxSize) {
+            throw InvalidCheckpointException("array of " + std::to_string(size) + " elements, at most " + std::to_string(maxSize) + " expected");
+        }
+        if (size > bytesLeft / sizeof(T)) {
+            throw InvalidCheckpointException("array of " + std::to_string(size) + " elements, only " + std::to_string(bytesLeft) + " bytes left in the file");
+        }
+        values.resize(size);
+        read(values.data(), size * sizeof(T));
+    }
+
+private:
+    std::istream &is;
+    std::size_t offset = 0;
+    std::uint64_t bytesLeft = UINT64_MAX;
+
+    void read(void *data, std::size_t bytes) {
+        char padding[Checkpoint::ALIGNMENT];
+        std::size_t rest = (Checkpoint::ALIGNMENT - (offset + bytes) % Checkpoint::ALIGNMENT) % Checkpoint::ALIGNMENT;
+        if (!is.read(static_cast<char *>(data), (std::streamsize) bytes) || !is.read(padding, (std::streamsize) rest)) {
+            throw InvalidCheckpointException("unexpected end of file");
+        }
+        offset += bytes + rest;
+        bytesLeft -= std::min<std::uint64_t>(bytesLeft, bytes + rest);
+    }
+};
+
+#endif //OOP_CHECKPOINT_H
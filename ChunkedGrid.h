@@ -0,0 +1,103 @@
+#ifndef OOP_CHUNKEDGRID_H
+#define OOP_CHUNKEDGRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// array of cells where only the chunks holding something other than the empty value take memory
+// a chunk is a run of CHUNK_CELLS consecutive positions; it is allocated by the first non-empty write
+// and handed back to a free list as soon as its last non-empty cell is emptied again,
+// so memory follows the occupied area instead of the size of the world
+template <typename T>
+class ChunkedGrid {
+public:
+    constexpr static int CHUNK_SHIFT = 6;
+    constexpr static int CHUNK_CELLS = 1 << CHUNK_SHIFT;
+
+    explicit ChunkedGrid(T empty = T{}) : empty(empty) {}
+
+    // forgets every chunk, all the size cells read as empty afterwards
+    void reset(std::size_t size);
+    [[nodiscard]] T operator[](std::size_t pos) const;
+    void set(std::size_t pos, T value);
+
+    [[nodiscard]] std::size_t size() const { return cellCount; }
+    [[nodiscard]] std::size_t getAllocatedChunks() const { return liveCells.size() - freeSlots.size(); }
+    // bytes held by the grid, including the chunks kept on the free list
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+private:
+    constexpr static std::uint32_t NO_CHUNK = UINT32_MAX;
+    constexpr static std::size_t CHUNK_MASK = CHUNK_CELLS - 1;
+
+    T empty;
+    std::size_t cellCount = 0;
+    // slot of every chunk of positions, NO_CHUNK while it is all empty
+    std::vector<std::uint32_t> chunkSlots;
+    // CHUNK_CELLS cells per slot
+    std::vector<T> cells;
+    // non-empty cells of every slot
+    std::vector<std::uint16_t> liveCells;
+    // slots whose cells are all empty again, reused before growing
+    std::vector<std::uint32_t> freeSlots;
+
+    std::uint32_t acquireSlot();
+};
+
+template <typename T>
+void ChunkedGrid<T>::reset(std::size_t size) {
+    cellCount = size;
+    chunkSlots.assign((size + CHUNK_MASK) >> CHUNK_SHIFT, NO_CHUNK);
+    cells.clear();
+    liveCells.clear();
+    freeSlots.clear();
+}
+
+template <typename T>
+T ChunkedGrid<T>::operator[](std::size_t pos) const {
+    std::uint32_t slot = chunkSlots[pos >> CHUNK_SHIFT];
+    return slot == NO_CHUNK ? empty : cells[((std::size_t) slot << CHUNK_SHIFT) | (pos & CHUNK_MASK)];
+}
+
+template <typename T>
+void ChunkedGrid<T>::set(std::size_t pos, T value) {
+    std::uint32_t &slot = chunkSlots[pos >> CHUNK_SHIFT];
+    if (slot == NO_CHUNK) {
+        if (value == empty) {
+            return;
+        }
+        slot = acquireSlot();
+    }
+    T &cell = cells[((std::size_t) slot << CHUNK_SHIFT) | (pos & CHUNK_MASK)];
+    bool wasEmpty = cell == empty;
+    bool isEmpty = value == empty;
+    cell = value;
+    if (wasEmpty && !isEmpty) {
+        liveCells[slot]++;
+    } else if (!wasEmpty && isEmpty && --liveCells[slot] == 0) {
+        freeSlots.push_back(slot);
+        slot = NO_CHUNK;
+    }
+}
+
+template <typename T>
+std::size_t ChunkedGrid<T>::getMemoryUsage() const {
+    return chunkSlots.capacity() * sizeof(std::uint32_t) + cells.capacity() * sizeof(T)
+           + liveCells.capacity() * sizeof(std::uint16_t) + freeSlots.capacity() * sizeof(std::uint32_t);
+}
+
+template <typename T>
+std::uint32_t ChunkedGrid<T>::acquireSlot() {
+    if (!freeSlots.empty()) {
+        std::uint32_t slot = freeSlots.back();
+        freeSlots.pop_back();
+        return slot;
+    }
+    auto slot = (std::uint32_t) liveCells.size();
+    cells.resize(cells.size() + CHUNK_CELLS, empty);
+    liveCells.push_back(0);
+    return slot;
+}
+
+#endif //OOP_CHUNKEDGRID_H
@@ -6,10 +6,9 @@
 
 class Clairvoyant : public Individual {
 public:
-    Clairvoyant(int x, int y);
-    [[nodiscard]] int getHunger() const override;
-    [[nodiscard]] int getVision() const override;
-    [[nodiscard]] sf::Color getOwnColor() const override;
+    const static IndividualType TYPE = CLAIRVOYANT_TYPE;
+
+    Clairvoyant(EntityStore &store, EntityStore::Id id);
 };
 
 #endif //OOP_CLAIRVOYANT_H
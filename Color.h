@@ -0,0 +1,32 @@
+#ifndef OOP_COLOR_H
+#define OOP_COLOR_H
+
+#include <cstdint>
+
+// plain RGB color, so that the simulation core does not depend on SFML
+// the viewer converts it to sf::Color when drawing
+struct Color {
+    std::uint8_t r = 0;
+    std::uint8_t g = 0;
+    std::uint8_t b = 0;
+
+    static const Color Black;
+    static const Color White;
+    static const Color Red;
+    static const Color Blue;
+    static const Color Yellow;
+    static const Color Magenta;
+    static const Color Cyan;
+
+    bool operator==(const Color &rhs) const = default;
+};
+
+inline constexpr Color Color::Black{0, 0, 0};
+inline constexpr Color Color::White{255, 255, 255};
+inline constexpr Color Color::Red{255, 0, 0};
+inline constexpr Color Color::Blue{0, 0, 255};
+inline constexpr Color Color::Yellow{255, 255, 0};
+inline constexpr Color Color::Magenta{255, 0, 255};
+inline constexpr Color Color::Cyan{0, 255, 255};
+
+#endif //OOP_COLOR_H
@@ -0,0 +1,104 @@
+#include "ColumnTable.h"
+#include <algorithm>
+#include <optional>
+#include "Exceptions.h"
+#include "Logger.h"
+
+ColumnTable::ColumnTable(const std::filesystem::path &directory, std::vector<std::string> names) : directory(directory), names(std::move(names)) {
+    // a species and a strategy of the same name would append twice to one file
+    for (const std::string &name : this->names) {
+        if (std::count(this->names.begin(), this->names.end(), name) > 1) {
+            throw StatisticsWriteException((directory / (name + ".i64")).string(), "repeated column");
+        }
+    }
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        throw StatisticsWriteException(directory.string(), error.message());
+    }
+    // a table is only appended to with the columns it was created with, anything else would misalign its rows
+    bool isExisting = std::filesystem::exists(directory / "columns.txt");
+    if (isExisting) {
+        rowCount = countExistingRows();
+    } else {
+        std::ofstream schema(directory / "columns.txt", std::ios::trunc);
+        for (const std::string &name : this->names) {
+            schema << name << "\n";
+        }
+        schema.close();
+        if (!schema) {
+            throw StatisticsWriteException((directory / "columns.txt").string());
+        }
+    }
+    for (const std::string &name : this->names) {
+        // column files left without a schema belong to no table, they are started over
+        files.emplace_back(directory / (name + ".i64"), std::ios::binary | (isExisting ? std::ios::app : std::ios::trunc));
+        if (!files.back()) {
+            throw StatisticsWriteException((directory / (name + ".i64")).string());
+        }
+        blocks.emplace_back().reserve(BLOCK_ROWS);
+    }
+}
+
+ColumnTable::~ColumnTable() {
+    try {
+        flush();
+    } catch (const StatisticsWriteException &e) {
+        logError(e.what());
+    }
+}
+
+std::size_t ColumnTable::countExistingRows() const {
+    std::ifstream schema(directory / "columns.txt");
+    std::vector<std::string> existingNames;
+    for (std::string name; std::getline(schema, name);) {
+        existingNames.push_back(name);
+    }
+    if (existingNames != names) {
+        throw StatisticsWriteException(directory.string(), "the existing table has other columns, use another directory");
+    }
+    std::optional<std::uintmax_t> rows;
+    for (const std::string &name : names) {
+        std::error_code error;
+        std::uintmax_t size = std::filesystem::file_size(directory / (name + ".i64"), error);
+        if (error || size % sizeof(std::int64_t) != 0 || (rows && *rows != size / sizeof(std::int64_t))) {
+            throw StatisticsWriteException((directory / (name + ".i64")).string(), "the column does not match the other ones of the existing table");
+        }
+        rows = size / sizeof(std::int64_t);
+    }
+    return rows.value_or(0);
+}
+
+void ColumnTable::append(std::span<const std::int64_t> row) {
+    for (std::size_t column = 0; column < blocks.size(); ++column) {
+        blocks[column].push_back(column < row.size() ? row[column] : 0);
+    }
+    rowCount++;
+    if (!blocks.empty() && blocks.front().size() >= BLOCK_ROWS) {
+        flush();
+    }
+}
+
+void ColumnTable::flush() {
+    writeBlocks();
+    for (std::size_t column = 0; column < files.size(); ++column) {
+        if (!files[column].flush()) {
+            throw StatisticsWriteException((directory / (names[column] + ".i64")).string());
+        }
+    }
+}
+
+void ColumnTable::writeBlocks() {
+    for (std::size_t column = 0; column < files.size(); ++column) {
+        files[column].write(reinterpret_cast<const char *>(blocks[column].data()), (std::streamsize) (blocks[column].size() * sizeof(std::int64_t)));
+        blocks[column].clear();
+    }
+}
+
+const std::vector<std::string> &ColumnTable::getNames() const {
+    return names;
+}
+
+std::size_t ColumnTable::getRowCount() const {
+    return rowCount;
+}
@@ -0,0 +1,47 @@
+#ifndef OOP_COLUMNTABLE_H
+#define OOP_COLUMNTABLE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+// append-only table stored column by column: a directory holding columns.txt, the names of the columns one per line,
+// and a <name>.i64 file per column with its values as raw 64-bit integers in the machine's byte order
+// (numpy.fromfile(path, "<i8") reads one back); opening an existing table appends to it, as long as it has the same columns
+// rows are gathered in memory and written a block at a time, so appending a row only costs a store per column
+class ColumnTable {
+public:
+    const static int BLOCK_ROWS = 1 << 16;
+
+    // throws StatisticsWriteException if the directory or its files cannot be created, if a name is repeated,
+    // or if the directory already holds a table with other columns or with columns of different lengths
+    ColumnTable(const std::filesystem::path &directory, std::vector<std::string> names);
+    ColumnTable(const ColumnTable &other) = delete;
+    ColumnTable& operator=(const ColumnTable &other) = delete;
+    // writes the rows still in memory, only logging a failure; call flush() to find out whether they made it to disk
+    ~ColumnTable();
+
+    // one value per column, in the order of the names
+    void append(std::span<const std::int64_t> row);
+    // writes the rows gathered so far; throws StatisticsWriteException if a file cannot be written
+    void flush();
+    [[nodiscard]] const std::vector<std::string> &getNames() const;
+    // rows of the table, those it already had on disk included
+    [[nodiscard]] std::size_t getRowCount() const;
+
+private:
+    std::filesystem::path directory;
+    std::vector<std::string> names;
+    std::vector<std::ofstream> files;
+    std::vector<std::vector<std::int64_t>> blocks;
+    std::size_t rowCount = 0;
+
+    // the rows already in the files of an existing table; throws StatisticsWriteException if they do not match the names
+    [[nodiscard]] std::size_t countExistingRows() const;
+    void writeBlocks();
+};
+
+#endif //OOP_COLUMNTABLE_H
@@ -0,0 +1,26 @@
+#include "ConfigParsing.h"
+#include <algorithm>
+#include <cctype>
+
+std::string trim(const std::string &text) {
+    auto first = text.find_first_not_of(" \t\r");
+    auto last = text.find_last_not_of(" \t\r");
+    return first == std::string::npos ? "" : text.substr(first, last - first + 1);
+}
+
+std::string stripComment(const std::string &line) {
+    return trim(line.substr(0, line.find('#')));
+}
+
+std::optional<std::pair<std::string, std::string>> splitAssignment(const std::string &line) {
+    auto equals = line.find('=');
+    if (equals == std::string::npos) {
+        return std::nullopt;
+    }
+    return std::make_pair(trim(line.substr(0, equals)), trim(line.substr(equals + 1)));
+}
+
+bool isValidConfigName(const std::string &name, std::size_t maxLength) {
+    return !name.empty() && name.size() <= maxLength && std::isalpha((unsigned char) name[0])
+           && std::all_of(name.begin(), name.end(), [](unsigned char c) { return std::isalnum(c) || c == '_'; });
+}
@@ -0,0 +1,53 @@
+#ifndef OOP_CONFIGPARSING_H
+#define OOP_CONFIGPARSING_H
+
+#include <charconv>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// the pieces shared by the files read at startup, the species file, the fighting file and the sweep grid:
+// "[name]" lines, "key = values" lines and '#' comments; the functions that reject a line throw the exception of the file
+// being read, any exception constructed from the line number and the reason
+
+// the text without the blanks around it
+std::string trim(const std::string &text);
+// the line without its comment and the blanks around what is left
+std::string stripComment(const std::string &line);
+// "key = values" split at the first '=', both sides trimmed; std::nullopt if there is no '='
+std::optional<std::pair<std::string, std::string>> splitAssignment(const std::string &line);
+// letters, digits and underscores, starting with a letter, as the names become column names as well
+bool isValidConfigName(const std::string &name, std::size_t maxLength);
+
+// the name of a "[name]" line without the blanks around it, std::nullopt for a line that does not start with '['
+template <typename Exception>
+std::optional<std::string> parseSectionName(int lineNumber, const std::string &line) {
+    if (line.empty() || line.front() != '[') {
+        return std::nullopt;
+    }
+    if (line.back() != ']') {
+        throw Exception(lineNumber, "expected [name]");
+    }
+    return trim(line.substr(1, line.size() - 2));
+}
+
+// the numbers of a list separated by blanks, each from 0 to maxValue
+template <typename Exception, typename Number>
+std::vector<Number> parseNumbers(int lineNumber, const std::string &key, const std::string &text, Number maxValue) {
+    std::vector<Number> numbers;
+    std::istringstream words(text);
+    std::string word;
+    while (words >> word) {
+        Number number;
+        auto result = std::from_chars(word.data(), word.data() + word.size(), number);
+        if (result.ec != std::errc() || result.ptr != word.data() + word.size() || std::cmp_less(number, 0) || number > maxValue) {
+            throw Exception(lineNumber, "invalid value " + word + " for " + key);
+        }
+        numbers.push_back(number);
+    }
+    return numbers;
+}
+
+#endif //OOP_CONFIGPARSING_H
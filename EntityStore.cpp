@@ -0,0 +1,109 @@
+#include "EntityStore.h"
+#include "Individual.h"
+#include "Food.h"
+#include "Exceptions.h"
+#include "Checkpoint.h"
+#include "Utils.h"
+
+EntityStore::Id EntityStore::createIndividual(int x, int y, IndividualType species, FightingStrategyType strategy, int direction,
+                                              IndividualType mateTarget) {
+    auto id = (Id) xs.size();
+    xs.push_back(x);
+    ys.push_back(y);
+    healths.push_back(0);
+    directions.push_back(direction);
+    speciesIds.push_back((std::uint8_t) species);
+    strategyIds.push_back((std::uint8_t) strategy);
+    mateTargets.push_back((std::uint8_t) mateTarget);
+    flags.push_back(0);
+    views.push_back(nullptr);
+    return id;
+}
+
+
+void EntityStore::clear() {
+    xs.clear();
+    ys.clear();
+    healths.clear();
+    directions.clear();
+    speciesIds.clear();
+    strategyIds.clear();
+    mateTargets.clear();
+    flags.clear();
+    destroyViews();
+}
+
+EntityStore::~EntityStore() {
+    destroyViews();
+}
+
+void EntityStore::destroyViews() {
+    // the arena only hands out memory, the views are destroyed here before it is reused
+    for (Cell *view : views) {
+        if (view) {
+            view->~Cell();
+        }
+    }
+    views.clear();
+    viewArena.reset();
+}
+
+void EntityStore::setWorldSize(int width, int height) {
+    worldWidth = width;
+    worldHeight = height;
+}
+
+std::size_t EntityStore::size() const {
+    return xs.size();
+}
+
+void EntityStore::writeCheckpoint(CheckpointWriter &writer) const {
+    writer.array(xs);
+    writer.array(ys);
+    writer.array(healths);
+    writer.array(directions);
+    writer.array(speciesIds);
+    writer.array(strategyIds);
+    writer.array(mateTargets);
+    writer.array(flags);
+}
+
+void EntityStore::readCheckpoint(CheckpointReader &reader) {
+    clear();
+    // every entity holds a cell of the world at some point, there cannot be more of them than cells
+    auto maxEntities = (std::uint64_t) worldWidth * worldHeight;
+    reader.array(xs, maxEntities);
+    reader.array(ys, xs.size());
+    reader.array(healths, xs.size());
+    reader.array(directions, xs.size());
+    reader.array(speciesIds, xs.size());
+    reader.array(strategyIds, xs.size());
+    reader.array(mateTargets, xs.size());
+    reader.array(flags, xs.size());
+    if (ys.size() != xs.size() || healths.size() != xs.size() || directions.size() != xs.size() || speciesIds.size() != xs.size()
+        || strategyIds.size() != xs.size() || mateTargets.size() != xs.size() || flags.size() != xs.size()) {
+        throw InvalidCheckpointException("entity arrays of different sizes");
+    }
+    // the coordinates index the board and the direction the steps, on the first tick already
+    for (Id id = 0; id < xs.size(); ++id) {
+        if (!isInsideBoard(xs[id], ys[id], worldWidth, worldHeight) || directions[id] < 0 || directions[id] >= NUMBERS_OF_DIRECTIONS) {
+            throw InvalidCheckpointException("entity " + std::to_string(id) + " out of the world or facing nowhere");
+        }
+    }
+    views.assign(xs.size(), nullptr);
+}
+
+const Cell &EntityStore::cell(Id id) const {
+    if (id == FOOD) {
+        return Food::getInstance();
+    }
+    return *views[id];
+}
+
+Individual &EntityStore::individual(Id id) const {
+    // the kind tag makes the downcast safe without paying for a dynamic_cast
+    if (!isIndividual(id) || views[id]->getKind() != INDIVIDUAL_KIND) {
+        throw InvalidIndividualException();
+    }
+    return static_cast<Individual &>(*views[id]);
+}
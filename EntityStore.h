@@ -0,0 +1,111 @@
+#ifndef OOP_ENTITYSTORE_H
+#define OOP_ENTITYSTORE_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Cell.h"
+#include "EpochArena.h"
+#include "IndividualType.h"
+#include "FightingStrategyType.h"
+#include "SpeciesRegistry.h"
+#include "FightingRules.h"
+
+class Individual;
+class CheckpointWriter;
+class CheckpointReader;
+
+// structure-of-arrays storage for everything that lives on the board
+// the board only holds entity ids; Individual and Suitor<T> objects are views over these arrays
+// food has no state at all, its cells hold the FOOD tag instead of an id
+class EntityStore {
+public:
+    using Id = std::uint32_t;
+    // id stored in an empty board cell
+    constexpr static Id NONE = UINT32_MAX;
+    // stored in a cell holding food
+    constexpr static Id FOOD = UINT32_MAX - 1;
+
+    EntityStore() = default;
+    // the views point back to the store and live in its arena
+    EntityStore(const EntityStore &other) = delete;
+    EntityStore& operator=(const EntityStore &other) = delete;
+    ~EntityStore();
+
+    Id createIndividual(int x, int y, IndividualType species, FightingStrategyType strategy, int direction,
+                        IndividualType mateTarget = INDIVIDUAL_TYPE_BEGIN);
+    // makes the view object of an entity in the store's arena; it lives until the store is cleared
+    template <typename T>
+    T *attachView(Id id);
+    // forgets every entity, keeping the allocated capacity and the arena's blocks for the next generation
+    void clear();
+    // bounds the individuals move within
+    void setWorldSize(int width, int height);
+    [[nodiscard]] int getWorldWidth() const { return worldWidth; }
+    [[nodiscard]] int getWorldHeight() const { return worldHeight; }
+    // the traits of the species the individuals read, owned by whoever owns the store; the built-in species until set
+    void setSpecies(const SpeciesRegistry &registry) { speciesRegistry = &registry; }
+    [[nodiscard]] const SpeciesRegistry &getSpecies() const { return *speciesRegistry; }
+    // the strategies new individuals are born with, owned by whoever owns the store; the built-in ones until set
+    void setFighting(const FightingRules &rules) { fightingRules = &rules; }
+    [[nodiscard]] const FightingRules &getFighting() const { return *fightingRules; }
+    [[nodiscard]] std::size_t size() const;
+    // the state arrays of every entity; the views are not saved, they are attached again once loaded
+    void writeCheckpoint(CheckpointWriter &writer) const;
+    // replaces every entity with the saved ones, without any view; throws InvalidCheckpointException if the arrays do not match
+    void readCheckpoint(CheckpointReader &reader);
+
+    [[nodiscard]] static bool isFood(Id id) { return id == FOOD; }
+    [[nodiscard]] static bool isIndividual(Id id) { return id < FOOD; }
+    // the one bit of state that moves a species to its second phase, see Species
+    [[nodiscard]] bool hasEaten(Id id) const { return (flags[id] & HAS_EATEN_FLAG) != 0; }
+    void markEaten(Id id) { flags[id] |= HAS_EATEN_FLAG; }
+
+    [[nodiscard]] int &x(Id id) { return xs[id]; }
+    [[nodiscard]] int x(Id id) const { return xs[id]; }
+    [[nodiscard]] int &y(Id id) { return ys[id]; }
+    [[nodiscard]] int y(Id id) const { return ys[id]; }
+    [[nodiscard]] int &health(Id id) { return healths[id]; }
+    [[nodiscard]] int health(Id id) const { return healths[id]; }
+    [[nodiscard]] int &direction(Id id) { return directions[id]; }
+    [[nodiscard]] int direction(Id id) const { return directions[id]; }
+    [[nodiscard]] IndividualType species(Id id) const { return (IndividualType) speciesIds[id]; }
+    [[nodiscard]] const Species &traits(Id id) const { return (*speciesRegistry)[species(id)]; }
+    [[nodiscard]] FightingStrategyType strategy(Id id) const { return (FightingStrategyType) strategyIds[id]; }
+    // species a suitor wants to mate with, INDIVIDUAL_TYPE_BEGIN for everybody else
+    [[nodiscard]] IndividualType mateTarget(Id id) const { return (IndividualType) mateTargets[id]; }
+
+    // view of an individual, or the shared Food for the FOOD tag
+    [[nodiscard]] const Cell &cell(Id id) const;
+    [[nodiscard]] Individual &individual(Id id) const;
+    [[nodiscard]] const EpochArena &getViewArena() const { return viewArena; }
+
+private:
+    const static std::uint8_t HAS_EATEN_FLAG = 1;
+
+    std::vector<int> xs;
+    std::vector<int> ys;
+    std::vector<int> healths;
+    std::vector<int> directions;
+    std::vector<std::uint8_t> speciesIds;
+    std::vector<std::uint8_t> strategyIds;
+    std::vector<std::uint8_t> mateTargets;
+    std::vector<std::uint8_t> flags;
+    std::vector<Cell *> views;
+    EpochArena viewArena;
+    int worldWidth = 0;
+    int worldHeight = 0;
+    const SpeciesRegistry *speciesRegistry = SpeciesRegistry::builtIn().get();
+    const FightingRules *fightingRules = FightingRules::builtIn().get();
+
+    void destroyViews();
+};
+
+template <typename T>
+T *EntityStore::attachView(Id id) {
+    T *view = viewArena.create<T>(*this, id);
+    views[id] = view;
+    return view;
+}
+
+#endif //OOP_ENTITYSTORE_H
@@ -0,0 +1,37 @@
+#include "EpochArena.h"
+#include <algorithm>
+
+void EpochArena::reset() {
+    currentBlock = 0;
+    offset = 0;
+    objectCount = 0;
+}
+
+std::size_t EpochArena::getMemoryUsage() const {
+    std::size_t total = blocks.capacity() * sizeof(Block);
+    for (const Block &block : blocks) {
+        total += block.size;
+    }
+    return total;
+}
+
+void *EpochArena::allocate(std::size_t size, std::size_t alignment) {
+    // the kept blocks are tried in order first, one only gets skipped when the object does not fit in what is left of it
+    while (currentBlock < blocks.size()) {
+        Block &block = blocks[currentBlock];
+        auto address = reinterpret_cast<std::size_t>(block.memory.get()) + offset;
+        std::size_t padding = (alignment - address % alignment) % alignment;
+        if (offset + padding + size <= block.size) {
+            offset += padding + size;
+            return block.memory.get() + offset - size;
+        }
+        currentBlock++;
+        offset = 0;
+    }
+    // new [] aligns for any fundamental type, so the first object of a block needs no padding
+    std::size_t blockSize = std::max(BLOCK_SIZE, size);
+    blocks.push_back({std::make_unique_for_overwrite<std::byte[]>(blockSize), blockSize});
+    currentBlock = blocks.size() - 1;
+    offset = size;
+    return blocks.back().memory.get();
+}
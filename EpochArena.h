@@ -0,0 +1,56 @@
+#ifndef OOP_EPOCHARENA_H
+#define OOP_EPOCHARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// memory for objects that all die together, handed out by bumping an offset through large blocks
+// reset() rewinds to the first block without giving any of them back, so once a generation has been spawned
+// the next ones of the same size are spawned without touching the heap
+// the arena does not run destructors, whoever creates the objects destroys them before the reset
+class EpochArena {
+public:
+    EpochArena() = default;
+    EpochArena(const EpochArena &other) = delete;
+    EpochArena& operator=(const EpochArena &other) = delete;
+
+    template <typename T, typename... Args>
+    T *create(Args &&...args);
+    // every object handed out so far is forgotten, the blocks are kept for the next ones
+    void reset();
+
+    // objects handed out since the last reset
+    [[nodiscard]] std::size_t getObjectCount() const { return objectCount; }
+    // blocks requested from the heap since the arena was made, the only allocations it ever does
+    [[nodiscard]] std::size_t getBlockAllocations() const { return blocks.size(); }
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+private:
+    constexpr static std::size_t BLOCK_SIZE = 64 * 1024;
+
+    struct Block {
+        std::unique_ptr<std::byte[]> memory;
+        std::size_t size;
+    };
+
+    std::vector<Block> blocks;
+    // block being filled and the first free byte inside it
+    std::size_t currentBlock = 0;
+    std::size_t offset = 0;
+    std::size_t objectCount = 0;
+
+    void *allocate(std::size_t size, std::size_t alignment);
+};
+
+template <typename T, typename... Args>
+T *EpochArena::create(Args &&...args) {
+    void *memory = allocate(sizeof(T), alignof(T));
+    T *object = new (memory) T(std::forward<Args>(args)...);
+    objectCount++;
+    return object;
+}
+
+#endif //OOP_EPOCHARENA_H
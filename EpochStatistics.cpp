@@ -0,0 +1,45 @@
+#include "EpochStatistics.h"
+#include <string>
+#include "Utils.h"
+
+int EpochStatistics::getTotalIndividuals() const {
+    int totalIndividuals = 0;
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species->end(); type = (IndividualType)(type + 1)) {
+        totalIndividuals += countOf(generation, type);
+    }
+    return totalIndividuals;
+}
+
+int EpochStatistics::getTotalSurvivors() const {
+    int totalSurvivors = 0;
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species->end(); type = (IndividualType)(type + 1)) {
+        totalSurvivors += countOf(survivors, type);
+    }
+    return totalSurvivors;
+}
+
+int EpochStatistics::getTotalSurvivalRate() const {
+    int totalIndividuals = getTotalIndividuals();
+    if (totalIndividuals == 0) {
+        return 0;
+    }
+    return (int) (100.0 * getTotalSurvivors() / totalIndividuals);
+}
+
+std::ostream &operator<<(std::ostream &os, const EpochStatistics &statistics) {
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != statistics.species->end(); type = IndividualType(type + 1)) {
+        int survived = countOf(statistics.survivors, type);
+        int spawned = countOf(statistics.generation, type);
+        os << (*statistics.species)[type].name << ": " << getPercentage(survived, spawned) << " survived. "
+           << "( " << survived << " / " << spawned << ")\n";
+    }
+
+    for (auto type = (FightingStrategyType)(FIGHTING_TYPE_BEGIN + 1); type != statistics.fighting->end(); type = FightingStrategyType(type + 1)) {
+        int survived = countOf(statistics.fightingStrategySurvivors, type);
+        os << (*statistics.fighting)[type].name << ": " << getPercentage(survived, statistics.getTotalSurvivors()) << "   ";
+    }
+
+    os << "\nTotal survival rate: " << statistics.getTotalSurvivalRate() << "%\n";
+    os << "Total offspring produced: " << statistics.matingsOccurred << ". Total individuals killed: " << statistics.killedIndividuals << ".\n";
+    return os;
+}
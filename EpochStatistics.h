@@ -0,0 +1,40 @@
+#ifndef OOP_EPOCHSTATISTICS_H
+#define OOP_EPOCHSTATISTICS_H
+
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include "IndividualType.h"
+#include "SpeciesRegistry.h"
+#include "FightingRules.h"
+
+// snapshot of the counters gathered during one epoch, taken before the next generation resets them
+struct EpochStatistics {
+    // the species the counters are kept for
+    std::shared_ptr<const SpeciesRegistry> species = SpeciesRegistry::builtIn();
+    // the strategies the survivors are counted for
+    std::shared_ptr<const FightingRules> fighting = FightingRules::builtIn();
+    int epoch = 0;
+    int killedIndividuals = 0;
+    int matingsOccurred = 0;
+    std::unordered_map<IndividualType, int> generation;
+    std::unordered_map<IndividualType, int> survivors;
+    std::unordered_map<FightingStrategyType, int> fightingStrategySurvivors;
+
+    [[nodiscard]] int getTotalIndividuals() const;
+    [[nodiscard]] int getTotalSurvivors() const;
+    [[nodiscard]] int getTotalSurvivalRate() const;
+    friend std::ostream &operator<<(std::ostream &os, const EpochStatistics &statistics);
+};
+
+// counters of the epoch so far, as they are at the end of a tick
+struct TickStatistics {
+    int epoch = 0;
+    int tick = 0;
+    int killedIndividuals = 0;
+    int matingsOccurred = 0;
+    // individuals and food on the board
+    int occupiedCells = 0;
+};
+
+#endif //OOP_EPOCHSTATISTICS_H
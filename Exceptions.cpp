@@ -15,19 +15,29 @@ InvalidIndividualPositionException::InvalidIndividualPositionException(int x, in
                                                                                                                         std::to_string(x) + ", " +
                                                                                                                         std::to_string(y) + ")") {}
 
-RanOutOfEmptyPositionsException::RanOutOfEmptyPositionsException(int x, int y, int radius) : runtime_error("Ran out of empty positions in radius " + std::to_string(radius) + " around (" +
-                                                                                                                        std::to_string(x) + ", " +
-                                                                                                                        std::to_string(y) + ")") {}
-
 NoSurvivorsException::NoSurvivorsException(int epochNumber) : runtime_error("No survivors in epoch " + std::to_string(epochNumber) + ".") {}
 
+InvalidWorldSizeException::InvalidWorldSizeException(int width, int height) : runtime_error("Invalid world size: " + std::to_string(width) + "x" +
+                                                                                                std::to_string(height)) {}
+
+InvalidSweepException::InvalidSweepException(int line, const std::string &reason) : runtime_error("Invalid sweep grid, line " + std::to_string(line) + ": " + reason) {}
+
+InvalidSpeciesException::InvalidSpeciesException(int line, const std::string &reason) : runtime_error("Invalid species file, line " + std::to_string(line) + ": " + reason) {}
+
+InvalidFightingRulesException::InvalidFightingRulesException(int line, const std::string &reason) : runtime_error("Invalid fighting file, line " + std::to_string(line) + ": " + reason) {}
+
+InvalidCheckpointException::InvalidCheckpointException(const std::string &reason) : runtime_error("Invalid checkpoint: " + reason) {}
+
+StatisticsWriteException::StatisticsWriteException(const std::string &file) : runtime_error("Failed to write statistics to " + file) {}
+
+StatisticsWriteException::StatisticsWriteException(const std::string &file, const std::string &reason)
+        : runtime_error("Failed to write statistics to " + file + ": " + reason) {}
+
 ResourceLoadException::ResourceLoadException(const std::string &file) : runtime_error("Failed to load resource: " + file) {}
 
 FontLoadingException::FontLoadingException(const std::string &file, const std::string &fontName) : ResourceLoadException("Failed to load font " + fontName + " from file " + file) {}
 
 
-NoFoodException::NoFoodException(int x, int y) : runtime_error("No food at position (" + std::to_string(x) + ", " + std::to_string(y) + ") for our creature.") {}
-
 InvalidFightingOutcomeException::InvalidFightingOutcomeException() : std::runtime_error("Invalid fighting outcome!") {}
 
 InvalidFightingStrategyType::InvalidFightingStrategyType() : std::runtime_error("Invalid fighting strategy type!") {}
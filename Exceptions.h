@@ -32,19 +32,40 @@ public:
     explicit InvalidFightingStrategyType();
 };
 
-class RanOutOfEmptyPositionsException : public std::runtime_error {
+class NoSurvivorsException : public std::runtime_error {
 public:
-    explicit RanOutOfEmptyPositionsException(int x, int y, int radius);
+    explicit NoSurvivorsException(int epochNumber);
 };
 
-class NoFoodException : public std::runtime_error {
+class InvalidWorldSizeException : public std::runtime_error {
 public:
-    explicit NoFoodException(int x, int y);
+    explicit InvalidWorldSizeException(int width, int height);
 };
 
-class NoSurvivorsException : public std::runtime_error {
+class InvalidSweepException : public std::runtime_error {
 public:
-    explicit NoSurvivorsException(int epochNumber);
+    explicit InvalidSweepException(int line, const std::string &reason);
+};
+
+class InvalidSpeciesException : public std::runtime_error {
+public:
+    explicit InvalidSpeciesException(int line, const std::string &reason);
+};
+
+class InvalidFightingRulesException : public std::runtime_error {
+public:
+    explicit InvalidFightingRulesException(int line, const std::string &reason);
+};
+
+class InvalidCheckpointException : public std::runtime_error {
+public:
+    explicit InvalidCheckpointException(const std::string &reason);
+};
+
+class StatisticsWriteException : public std::runtime_error {
+public:
+    explicit StatisticsWriteException(const std::string &file);
+    StatisticsWriteException(const std::string &file, const std::string &reason);
 };
 
 class ResourceLoadException : public std::runtime_error {
@@ -5,10 +5,12 @@
 #ifndef OOP_FIGHTINGOUTCOME_H
 #define OOP_FIGHTINGOUTCOME_H
 
+// what an encounter does to the individual moving into the cell and to the one already there, in this order
 enum FightingOutcome {
     LIVE_LIVE,
     LIVE_DIE,
-    DIE_LIVE
+    DIE_LIVE,
+    FIGHTING_OUTCOME_END
 };
 
 #endif //OOP_FIGHTINGOUTCOME_H
@@ -0,0 +1,226 @@
+#include "FightingRules.h"
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+#include "Checkpoint.h"
+#include "ConfigParsing.h"
+#include "Exceptions.h"
+#include "Random.h"
+#include "Utils.h"
+
+namespace {
+    const std::string COLOR_KEY = "color";
+
+    bool isValidName(const std::string &name) {
+        return isValidConfigName(name, FightingRules::MAX_NAME_LENGTH) && toColumnName(name) != COLOR_KEY;
+    }
+
+    bool isValidOdds(const FightingRules::Odds &odds) {
+        return std::all_of(odds.begin(), odds.end(), [](int odd) { return odd >= 0 && odd <= FightingRules::MAX_ODDS; });
+    }
+
+    bool fights(FightingStrategyType type) {
+        return type != FIGHTING_TYPE_BEGIN && type != LOVER_TYPE;
+    }
+}
+
+FightingRules::FightingRules() {
+    strategies.resize(FIGHTING_TYPE_END);
+    strategies[DEFENSIVE_TYPE] = {"Defensive", Color::White};
+    strategies[OFFENSIVE_TYPE] = {"Offensive", Color::Black};
+    strategies[LOVER_TYPE] = {"Lover", Color::White};
+    resizePairs(0);
+    // the attacker is the individual moving into the cell
+    setOdds(DEFENSIVE_TYPE, DEFENSIVE_TYPE, {1, 0, 0});
+    setOdds(DEFENSIVE_TYPE, OFFENSIVE_TYPE, {0, 0, 1});
+    setOdds(OFFENSIVE_TYPE, DEFENSIVE_TYPE, {0, 1, 0});
+    setOdds(OFFENSIVE_TYPE, OFFENSIVE_TYPE, {1, 0, 1});
+    listFighters();
+}
+
+FightingRules::FightingRules(std::istream &config) : FightingRules() {
+    // an opponent may be a strategy further down the file, the odds are set once everything is read
+    struct PendingOdds {
+        int lineNumber;
+        FightingStrategyType attacker;
+        std::string defender;
+        Odds odds;
+    };
+    std::vector<PendingOdds> pending;
+    std::optional<FightingStrategyType> current;
+    std::string line;
+    for (int lineNumber = 1; std::getline(config, line); ++lineNumber) {
+        line = stripComment(line);
+        if (line.empty()) {
+            continue;
+        }
+        if (auto name = parseSectionName<InvalidFightingRulesException>(lineNumber, line)) {
+            if (!isValidName(*name)) {
+                throw InvalidFightingRulesException(lineNumber, "invalid strategy name " + *name);
+            }
+            current = find(*name);
+            if (current == LOVER_TYPE) {
+                throw InvalidFightingRulesException(lineNumber, "lovers do not fight");
+            }
+            if (!current) {
+                if ((int) strategies.size() >= MAX_STRATEGIES) {
+                    throw InvalidFightingRulesException(lineNumber, "more than " + std::to_string(MAX_STRATEGIES - 1) + " strategies");
+                }
+                current = end();
+                strategies.push_back({*name, Color::White});
+                resizePairs(strategies.size() - 1);
+            }
+            continue;
+        }
+        if (!current) {
+            throw InvalidFightingRulesException(lineNumber, "expected [name] before the first line of odds");
+        }
+        auto assignment = splitAssignment(line);
+        if (!assignment) {
+            throw InvalidFightingRulesException(lineNumber, "expected key = values");
+        }
+        const auto &[key, values] = *assignment;
+        if (key == COLOR_KEY) {
+            auto numbers = parseNumbers<InvalidFightingRulesException>(lineNumber, key, values, (int) UINT8_MAX);
+            if (numbers.size() != 3) {
+                throw InvalidFightingRulesException(lineNumber, "color takes red, green and blue, from 0 to 255");
+            }
+            strategies[*current].color = {(std::uint8_t) numbers[0], (std::uint8_t) numbers[1], (std::uint8_t) numbers[2]};
+            continue;
+        }
+        auto numbers = parseNumbers<InvalidFightingRulesException>(lineNumber, key, values, MAX_ODDS);
+        if (numbers.size() != FIGHTING_OUTCOME_END || std::accumulate(numbers.begin(), numbers.end(), 0) == 0) {
+            throw InvalidFightingRulesException(lineNumber, key + " takes the odds of both living, of killing and of dying, not all of them 0");
+        }
+        pending.push_back({lineNumber, *current, key, {numbers[0], numbers[1], numbers[2]}});
+    }
+    for (const auto &[lineNumber, attacker, defenderName, odds] : pending) {
+        auto defender = find(defenderName);
+        if (!defender || !fights(*defender)) {
+            throw InvalidFightingRulesException(lineNumber, defenderName + " is not a strategy that fights");
+        }
+        setOdds(attacker, *defender, odds);
+    }
+    listFighters();
+}
+
+const std::shared_ptr<const FightingRules> &FightingRules::builtIn() {
+    static const std::shared_ptr<const FightingRules> rules = std::make_shared<const FightingRules>();
+    return rules;
+}
+
+std::shared_ptr<const FightingRules> FightingRules::load(const std::string &path) {
+    if (path.empty()) {
+        return builtIn();
+    }
+    std::ifstream file(path);
+    if (!file) {
+        throw ResourceLoadException(path);
+    }
+    return std::make_shared<const FightingRules>(file);
+}
+
+std::optional<FightingStrategyType> FightingRules::find(const std::string &name) const {
+    // the names are column names as well, where the case is lost
+    for (auto type = (FightingStrategyType) (FIGHTING_TYPE_BEGIN + 1); type != end(); type = (FightingStrategyType) (type + 1)) {
+        if (toColumnName(strategies[type].name) == toColumnName(name)) {
+            return type;
+        }
+    }
+    return std::nullopt;
+}
+
+FightingOutcome FightingRules::resolve(FightingStrategyType attacker, FightingStrategyType defender) const {
+    const Pair &pair = pairs[index(attacker, defender)];
+    int roll = pair.isSure ? 0 : randomIntegerFromInterval(0, pair.total - 1);
+    for (int outcome = 0; outcome < FIGHTING_OUTCOME_END; ++outcome) {
+        roll -= pair.odds[outcome];
+        if (roll < 0) {
+            return (FightingOutcome) outcome;
+        }
+    }
+    throw InvalidFightingOutcomeException();
+}
+
+void FightingRules::setOdds(FightingStrategyType attacker, FightingStrategyType defender, const Odds &odds) {
+    Pair &pair = pairs[index(attacker, defender)];
+    pair.odds = odds;
+    pair.total = std::accumulate(odds.begin(), odds.end(), 0);
+    pair.isSure = std::count(odds.begin(), odds.end(), 0) == FIGHTING_OUTCOME_END - 1;
+}
+
+void FightingRules::resizePairs(std::size_t oldCount) {
+    std::vector<Pair> resized(strategies.size() * strategies.size());
+    for (std::size_t attacker = 0; attacker < oldCount; ++attacker) {
+        std::copy_n(pairs.begin() + (std::ptrdiff_t) (attacker * oldCount), oldCount, resized.begin() + (std::ptrdiff_t) (attacker * strategies.size()));
+    }
+    pairs = std::move(resized);
+}
+
+void FightingRules::listFighters() {
+    // the order individuals picked their strategy in before there was a table, so that the built-in rules fight as they did
+    fighters = {OFFENSIVE_TYPE, DEFENSIVE_TYPE};
+    for (auto type = FIGHTING_TYPE_END; type < end(); type = (FightingStrategyType) (type + 1)) {
+        fighters.push_back(type);
+    }
+}
+
+std::optional<std::string> FightingRules::findProblem() const {
+    if (strategies.size() < FIGHTING_TYPE_END || (int) strategies.size() > MAX_STRATEGIES) {
+        return std::to_string(strategies.size()) + " strategies";
+    }
+    for (auto type = (FightingStrategyType) (FIGHTING_TYPE_BEGIN + 1); type != end(); type = (FightingStrategyType) (type + 1)) {
+        if (!isValidName(strategies[type].name) || find(strategies[type].name) != type) {
+            return "invalid or repeated strategy name " + strategies[type].name;
+        }
+    }
+    for (auto attacker = FIGHTING_TYPE_BEGIN; attacker != end(); attacker = (FightingStrategyType) (attacker + 1)) {
+        for (auto defender = FIGHTING_TYPE_BEGIN; defender != end(); defender = (FightingStrategyType) (defender + 1)) {
+            const Pair &pair = pairs[index(attacker, defender)];
+            if (!isValidOdds(pair.odds) || (fights(attacker) && fights(defender) && pair.total == 0)) {
+                return "invalid odds of " + strategies[attacker].name + " against " + strategies[defender].name;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
+void FightingRules::writeCheckpoint(CheckpointWriter &writer) const {
+    writer.value((std::uint64_t) strategies.size());
+    for (auto type = (FightingStrategyType) (FIGHTING_TYPE_BEGIN + 1); type != end(); type = (FightingStrategyType) (type + 1)) {
+        writer.array(std::vector<char>(strategies[type].name.begin(), strategies[type].name.end()));
+        writer.value(strategies[type].color);
+    }
+    for (const Pair &pair : pairs) {
+        writer.value(pair.odds);
+    }
+}
+
+void FightingRules::readCheckpoint(CheckpointReader &reader) {
+    auto count = reader.value<std::uint64_t>();
+    if (count < FIGHTING_TYPE_END || count > MAX_STRATEGIES) {
+        throw InvalidCheckpointException(std::to_string(count) + " strategies");
+    }
+    strategies.assign(count, FightingStrategy());
+    std::vector<char> name;
+    for (auto type = (FightingStrategyType) (FIGHTING_TYPE_BEGIN + 1); type != end(); type = (FightingStrategyType) (type + 1)) {
+        reader.array(name, MAX_NAME_LENGTH);
+        strategies[type].name.assign(name.begin(), name.end());
+        strategies[type].color = reader.value<Color>();
+    }
+    resizePairs(0);
+    for (auto attacker = FIGHTING_TYPE_BEGIN; attacker != end(); attacker = (FightingStrategyType) (attacker + 1)) {
+        for (auto defender = FIGHTING_TYPE_BEGIN; defender != end(); defender = (FightingStrategyType) (defender + 1)) {
+            auto odds = reader.value<Odds>();
+            // checked before adding them up
+            if (!isValidOdds(odds)) {
+                throw InvalidCheckpointException("invalid odds of " + strategies[attacker].name + " against " + strategies[defender].name);
+            }
+            setOdds(attacker, defender, odds);
+        }
+    }
+    if (auto problem = findProblem()) {
+        throw InvalidCheckpointException(*problem);
+    }
+    listFighters();
+}
@@ -0,0 +1,88 @@
+#ifndef OOP_FIGHTINGRULES_H
+#define OOP_FIGHTINGRULES_H
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Color.h"
+#include "FightingOutcome.h"
+#include "FightingStrategyType.h"
+
+class CheckpointWriter;
+class CheckpointReader;
+
+// how the individuals born with a strategy look; how they fight is in the table of FightingRules
+struct FightingStrategy {
+    std::string name;
+    // mixed into the color of the species
+    Color color = Color::White;
+};
+
+// every fighting strategy of a simulation and the outcome of an encounter for each pair of them, in flat tables indexed by FightingStrategyType
+// the built-in strategies keep their enum values and the ones read from a fighting file follow from FIGHTING_TYPE_END on;
+// lovers never fight, a suitor mates or walks away instead
+class FightingRules {
+public:
+    // relative odds of each FightingOutcome, for the individual moving into a cell against the one already there
+    using Odds = std::array<int, FIGHTING_OUTCOME_END>;
+    // strategy ids are stored in a byte
+    constexpr static int MAX_STRATEGIES = UINT8_MAX;
+    // names are letters, digits and underscores, starting with a letter
+    constexpr static int MAX_NAME_LENGTH = 64;
+    // keeps the sum of the odds of a pair within an int
+    constexpr static int MAX_ODDS = 1000000;
+
+    // offensive and defensive, as the simulator was written with
+    FightingRules();
+    // the built-in rules changed and extended by a fighting file: "[name]" starts a strategy, followed by "color = red green blue"
+    // and "<opponent> = live_live live_die die_live" lines with the odds against the individual already in the cell;
+    // a built-in name changes that strategy, any other adds one that new individuals may be born with, against which
+    // every pair not given ends with both alive; '#' starts a comment; throws InvalidFightingRulesException
+    explicit FightingRules(std::istream &config);
+
+    // shared by every simulation that is not given a fighting file
+    static const std::shared_ptr<const FightingRules> &builtIn();
+    // the built-in rules for an empty path; throws ResourceLoadException if the file cannot be read
+    static std::shared_ptr<const FightingRules> load(const std::string &path);
+
+    [[nodiscard]] const FightingStrategy &operator[](FightingStrategyType type) const { return strategies[type]; }
+    // one past the last strategy, the bound of every loop over them
+    [[nodiscard]] FightingStrategyType end() const { return (FightingStrategyType) strategies.size(); }
+    [[nodiscard]] std::optional<FightingStrategyType> find(const std::string &name) const;
+    // the strategies an individual that is not a suitor is born with, one of them at random
+    [[nodiscard]] const std::vector<FightingStrategyType> &getFighters() const { return fighters; }
+    [[nodiscard]] const Odds &getOdds(FightingStrategyType attacker, FightingStrategyType defender) const { return pairs[index(attacker, defender)].odds; }
+    // draws the outcome from the random engine of the thread, only when more than one outcome is possible
+    [[nodiscard]] FightingOutcome resolve(FightingStrategyType attacker, FightingStrategyType defender) const;
+    void writeCheckpoint(CheckpointWriter &writer) const;
+    // replaces every strategy and every pair with the saved ones; throws InvalidCheckpointException if they do not make sense
+    void readCheckpoint(CheckpointReader &reader);
+
+private:
+    struct Pair {
+        Odds odds{1, 0, 0};
+        int total = 1;
+        // a sure outcome takes no random number, as it never did
+        bool isSure = true;
+    };
+
+    // [FIGHTING_TYPE_BEGIN] is a placeholder, so that the enum values index the table
+    std::vector<FightingStrategy> strategies;
+    // attacker * strategies.size() + defender
+    std::vector<Pair> pairs;
+    std::vector<FightingStrategyType> fighters;
+
+    [[nodiscard]] std::size_t index(FightingStrategyType attacker, FightingStrategyType defender) const { return attacker * strategies.size() + defender; }
+    void setOdds(FightingStrategyType attacker, FightingStrategyType defender, const Odds &odds);
+    // grows the table to the strategies, every new pair ending with both alive
+    void resizePairs(std::size_t oldCount);
+    void listFighters();
+    // what the simulation relies on: valid and distinct names and odds that can be drawn from; the reason if not
+    [[nodiscard]] std::optional<std::string> findProblem() const;
+};
+
+#endif //OOP_FIGHTINGRULES_H
@@ -1,6 +0,0 @@
-//
-// Created by anna on 5/21/23.
-//
-
-#include "FightingStrategy.h"
-#include <memory>
@@ -1,9 +1,12 @@
 #ifndef OOP_FIGHTINGSTRATEGYTYPE_H
 #define OOP_FIGHTINGSTRATEGYTYPE_H
 
+#include <cstdint>
 #include <string>
 
-enum FightingStrategyType {
+// the strategies built into the simulator; those read from a fighting file take the values from FIGHTING_TYPE_END on, see FightingRules
+// a byte, like the ids kept by the entity store
+enum FightingStrategyType : std::uint8_t {
     FIGHTING_TYPE_BEGIN,
     DEFENSIVE_TYPE,
     OFFENSIVE_TYPE,
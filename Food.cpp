@@ -1,22 +1,19 @@
 #include "Food.h"
-#include "Utils.h"
-#include <SFML/Graphics.hpp>
 
-Food::Food(int x, int y) : x(x), y(y) {}
+Food::Food() : Cell(FOOD_KIND) {}
 
-Food::Food() : x(randomIntegerFromInterval(0, MAX_X)), y(randomIntegerFromInterval(0, MAX_Y)) {}
-
-Food::Food(const Food &other) : x(other.x), y(other.y) {}
-
-Food& Food::operator=(const Food &other) = default;
+const Food &Food::getInstance() {
+    static const Food instance;
+    return instance;
+}
 
-std::ostream &operator<<(std::ostream &os, const Food &food) {
-    os << "FOOD - " << food.x << " " << food.y << "\n";
+std::ostream &operator<<(std::ostream &os, const Food &) {
+    os << "FOOD\n";
     return os;
 }
 
 Food::~Food() = default;
 
-sf::Color Food::getColor() const {
+Color Food::getColor() const {
     return {0, 100, 0};
 }
@@ -1,19 +1,19 @@
 #pragma once
 
-#include <SFML/Graphics.hpp>
 #include <ostream>
 #include "Cell.h"
 
+// every piece of food is the same, so the board marks food cells with EntityStore::FOOD
+// and this single object stands for all of them wherever a Cell is needed
 class Food : public Cell {
 public:
-    Food(int x, int y);
-    Food();
-    Food(const Food &other);
-    Food& operator=(const Food &other);
+    static const Food &getInstance();
+    Food(const Food &other) = delete;
+    Food& operator=(const Food &other) = delete;
     ~Food() override;
     friend std::ostream &operator<<(std::ostream &os, const Food &food);
-    [[nodiscard]] sf::Color getColor() const override;
+    [[nodiscard]] Color getColor() const override;
 
 private:
-    int x, y;
-};
\ No newline at end of file
+    Food();
+};
@@ -0,0 +1,36 @@
+#include "FoodIndex.h"
+#include <algorithm>
+
+void FoodIndex::rebuild(const ChunkedGrid<EntityStore::Id> &board, std::span<const int> occupiedCells, int width, int height) {
+    food.reset(width, height);
+    blocks.reset((width + (1 << BLOCK_SHIFT) - 1) >> BLOCK_SHIFT, (height + (1 << BLOCK_SHIFT) - 1) >> BLOCK_SHIFT);
+    long long foodCells = 0;
+    for (int pos : occupiedCells) {
+        if (EntityStore::isFood(board[pos])) {
+            food.set(pos);
+            blocks.set((pos / width >> BLOCK_SHIFT) * blocks.getWidth() + (pos % width >> BLOCK_SHIFT));
+            foodCells++;
+        }
+    }
+    isSparse = foodCells * SPARSE_CELLS_PER_FOOD < (long long) width * height;
+    isCrowded = foodCells * CROWDED_CELLS_PER_FOOD >= (long long) width * height;
+}
+
+bool FoodIndex::hasFoodAround(int x, int y, int radius) const {
+    int x0 = std::max(x - radius, 0) >> BLOCK_SHIFT, x1 = std::min(x + radius, food.getWidth() - 1) >> BLOCK_SHIFT;
+    int y0 = std::max(y - radius, 0) >> BLOCK_SHIFT, y1 = std::min(y + radius, food.getHeight() - 1) >> BLOCK_SHIFT;
+    // a square wider than a window of blocks is left to the search itself
+    if (x1 - x0 >= 64) {
+        return true;
+    }
+    std::uint64_t columns = ~std::uint64_t{0} >> (63 - (x1 - x0));
+    std::uint64_t found = 0;
+    for (int by = y0; by <= y1; ++by) {
+        found |= blocks.window(by, x0);
+    }
+    return (found & columns) != 0;
+}
+
+std::size_t FoodIndex::getMemoryUsage() const {
+    return food.getMemoryUsage() + blocks.getMemoryUsage();
+}
@@ -0,0 +1,55 @@
+#ifndef OOP_FOODINDEX_H
+#define OOP_FOODINDEX_H
+
+#include <optional>
+#include <span>
+#include "ChunkedGrid.h"
+#include "EntityStore.h"
+#include "RowBitmap.h"
+
+// per-tick spatial index of the food on the board: one bit per cell, so that a search reads one word per row of its square
+// instead of every cell; the bitmap is refilled from the occupied cells only and only the words set last time are cleared,
+// so a rebuild costs the same on a small world and on a huge, mostly empty one; at one bit per cell
+// it is the only part of the world whose memory still follows the area, 2 MiB for 4096x4096;
+// a second bitmap keeps one bit per 8x8 block that holds food, so that on a sparse board a search around no food at all
+// reads a window per eight rows instead of one per row
+class FoodIndex {
+public:
+    // forgets the food of the previous rebuild and records the food among the given occupied cells of the board
+    void rebuild(const ChunkedGrid<EntityStore::Id> &board, std::span<const int> occupiedCells, int width, int height);
+    // the food cell closest to (x, y) inside the square of the given radius that satisfies isClaimable,
+    // the first in reading order among equally close ones; on a crowded board the cells are walked nearest first
+    // and the search stops at the first claimable food, on the others the rows of the square are read
+    template <typename Predicate>
+    std::optional<int> find(int x, int y, int radius, Predicate &&isClaimable) const;
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+private:
+    constexpr static int BLOCK_SHIFT = 3;
+    // below one food in this many cells most searches find none and the blocks pay off, above it the rows turn an empty square
+    // down as fast as the blocks do, on a bitmap that stays in the cache
+    constexpr static int SPARSE_CELLS_PER_FOOD = 1024;
+    // from one food in this many cells the nearest food is close enough that walking the cells nearest first beats the rows
+    constexpr static int CROWDED_CELLS_PER_FOOD = 16;
+
+    RowBitmap food{false};
+    RowBitmap blocks{false};
+    bool isSparse = false;
+    bool isCrowded = false;
+
+    // whether any block that overlaps the square of the given radius around (x, y) holds food
+    [[nodiscard]] bool hasFoodAround(int x, int y, int radius) const;
+};
+
+template <typename Predicate>
+std::optional<int> FoodIndex::find(int x, int y, int radius, Predicate &&isClaimable) const {
+    if (isSparse && !hasFoodAround(x, y, radius)) {
+        return std::nullopt;
+    }
+    if (isCrowded) {
+        return food.findNearest(x, y, radius, true, isClaimable);
+    }
+    return food.findNearestByRows(x, y, radius, true, isClaimable);
+}
+
+#endif //OOP_FOODINDEX_H
@@ -0,0 +1,19 @@
+#include "FreeCellIndex.h"
+
+void FreeCellIndex::reset(int width, int height) {
+    taken.reset(width, height);
+}
+
+void FreeCellIndex::clear() {
+    taken.clear();
+}
+
+std::optional<int> FreeCellIndex::findNearest(int x, int y, int radius) const {
+    return taken.findNearest(x, y, radius, false, [](int) {
+        return true;
+    });
+}
+
+std::size_t FreeCellIndex::getMemoryUsage() const {
+    return taken.getMemoryUsage();
+}
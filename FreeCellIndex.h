@@ -0,0 +1,25 @@
+#ifndef OOP_FREECELLINDEX_H
+#define OOP_FREECELLINDEX_H
+
+#include <optional>
+#include "RowBitmap.h"
+
+// taken cells of the board being filled during a tick, so that looking for a free cell reads whole words of a row
+// instead of testing one cell at a time; the cells off the board count as taken
+class FreeCellIndex {
+public:
+    // a new world, all of it free
+    void reset(int width, int height);
+    void take(int pos) { taken.set(pos); }
+    // frees every cell taken since the last clear
+    void clear();
+    // the free cell closest to (x, y) inside the square of the given radius, the first in reading order among equally close ones;
+    // std::nullopt if the whole square is taken
+    [[nodiscard]] std::optional<int> findNearest(int x, int y, int radius) const;
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+private:
+    RowBitmap taken{true};
+};
+
+#endif //OOP_FREECELLINDEX_H
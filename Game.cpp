@@ -1,478 +1,231 @@
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include "Game.h"
-#include "Food.h"
-#include "Individual.h"
-#include "Cell.h"
+#include "Ascendant.h"
 #include "CellFactory.h"
-#include "IndividualType.h"
 #include "Exceptions.h"
-#include "DefensiveFightingStrategy.h"
-#include "OffensiveFightingStrategy.h"
+#include "Logger.h"
 #include <SFML/Graphics.hpp>
 
 
-template<typename K>
-void Game::produceOffspring(int pos) {
-    auto freeSpot = findFreeSpot(pos, 15);
-    auto offspring = CellFactory::createSuitor<K>(freeSpot / width, freeSpot % width);
-
-    // Each baby starts off with 3 food points at birth.
-    for (int i = 0; i < 3; ++i) {
-        offspring->eat();
-    }
-
-    futureBoard[freeSpot] = offspring;
+sf::Color toSfColor(const Color &color) {
+    return {color.r, color.g, color.b};
 }
 
-template<typename K>
-void Game::mate(std::shared_ptr<K> individual, std::shared_ptr<Suitor<K>> suitor) {
-    if (individual == nullptr || suitor == nullptr) {
-        return;
+void initializeFont(sf::Font& font) {
+    if (!font.loadFromFile("assets/RobotoMono-Regular.ttf")) {
+        throw FontLoadingException("assets/RobotoMono-Regular.ttf", "Roboto Mono");
     }
+}
 
-    // When a couple mates, they can either produce one, two or three babies - this number gets chosen randomly.
-    int offspringQuantity = randomIntegerFromInterval(1, 3);
-    for (int i = 0; i < offspringQuantity; ++i) {
-        // If there are no more empty spots on the board, the mating process stops.
-        try {
-            produceOffspring<K>(individual->getPosition());
-            matingsOccurred++;
-        } catch (const RanOutOfEmptyPositionsException &e) {
-            std::cout << e.what() << std::endl;
-        }
+namespace {
+    SimulationConfig promptViewerConfig(const std::string &speciesPath, const std::string &fightingPath) {
+        auto fighting = FightingRules::load(fightingPath);
+        SimulationConfig config = promptSimulationConfig(SpeciesRegistry::load(speciesPath));
+        config.fighting = fighting;
+        config.timePhases = true;
+        return config;
     }
-    std::cout << "Successful mating!" << std::endl;
 }
 
-
-Game &Game::getInstance() {
-    static Game instance;
+Game &Game::getInstance(const std::string &speciesPath, const std::string &fightingPath) {
+    static Game instance(speciesPath, fightingPath);
     return instance;
 }
 
-// Total number of survivors: p1 * x1 + p2 * x2 + ...
-// Total number of individuals: x1 + x2 + ...
-// Number of individuals of given species, proportional to their fitness: (p1 * x1 / (total number of survivors)) * (total number of individuals)
-std::unordered_map<IndividualType, int> Game::computeNewGeneration() {
-    std::unordered_map<IndividualType, int> newGeneration;
-    int totalIndividuals = getTotalIndividuals();
-    int totalSurvivors = getTotalSurvivors();
-    if (totalSurvivors == 0) {
-        throw NoSurvivorsException(epochCounter);
-    }
-    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != INDIVIDUAL_TYPE_END; type = (IndividualType) (type + 1)) {
-        newGeneration[type] = currentGeneration[type] == 0 ? 0 : (int) ((1.0 * survivorMap[type] / currentGeneration[type]) * currentGeneration[type] * totalIndividuals) / totalSurvivors;
-    }
-    return newGeneration;
-}
-
-void Game::assertFitnessOfIndividual(const std::shared_ptr<Individual>& individual) {
-    checkCoordinates(individual->getPosition());
-    if (!individual->checkIfAlive()) {
-        board[individual->getPosition()] = nullptr;
-    } else {
-        if (dynamic_pointer_cast<Keystone>(individual)) {
-            survivorMap[KEYSTONE_TYPE] += 1;
-        } else if (std::dynamic_pointer_cast<Clairvoyant>(individual)) {
-            survivorMap[CLAIRVOYANT_TYPE] += 1;
-        } else if (std::dynamic_pointer_cast<RedBull>(individual)) {
-            survivorMap[REDBULL_TYPE] += 1;
-        } else if (std::dynamic_pointer_cast<Ascendant>(individual)) {
-            survivorMap[ASCENDANT_TYPE] += 1;
+void Game::simulate(std::stop_token stopToken) {
+    auto nextTick = std::chrono::steady_clock::now();
+    publish();
+    while (!stopToken.stop_requested()) {
+        if (simulation.isEpochOver()) {
+            {
+                // a SPACE pressed during the epoch does not count, the player has not seen the statistics yet
+                std::lock_guard lock(resumeMutex);
+                isResumeRequested = false;
+            }
+            publish(simulation.endEpoch());
+            if (!waitForResume(stopToken)) {
+                return;
+            }
+            try {
+                simulation.spawnNextGeneration();
+            } catch (const NoSurvivorsException &e) {
+                logInfo(e.what());
+                logInfo("Game over!");
+                publish(std::nullopt, true);
+                return;
+            }
+            publish();
+            nextTick = std::chrono::steady_clock::now();
         } else {
-            survivorMap[SUITOR_TYPE] += 1;
-        }
-
-        if (individual->getFightingStrategy() == nullptr) {
-            fightingStrategyMap[LOVER_TYPE] += 1;
-        } else if (std::dynamic_pointer_cast<DefensiveFightingStrategy>(individual->getFightingStrategy())) {
-            fightingStrategyMap[DEFENSIVE_TYPE] += 1;
-        } else if (std::dynamic_pointer_cast<OffensiveFightingStrategy>(individual->getFightingStrategy())) {
-            fightingStrategyMap[OFFENSIVE_TYPE] += 1;
+            simulation.step();
+            publish();
         }
+        nextTick += TICK_INTERVAL;
+        std::this_thread::sleep_until(nextTick);
     }
 }
 
-void Game::computeFitness() {
-    for (auto &cell : board) {
-        if (cell != nullptr) {
-            // check if the cell has the same type as individual
-            // for instance, if I pass a Redbull, check if the cell is a Redbull
-            auto individualCell = dynamic_pointer_cast<Individual>(cell);
-            if (individualCell != nullptr) {
-                try {
-                    assertFitnessOfIndividual(individualCell);
-                } catch (const InvalidIndividualPositionException &e) {
-                    std::cout << e.what() << std::endl;
-                }
-            }
-        }
-    }
+bool Game::waitForResume(std::stop_token stopToken) {
+    std::unique_lock lock(resumeMutex);
+    return resumeSignal.wait(lock, stopToken, [this] { return isResumeRequested; });
+}
 
-    for (int i = 0; i < width * height; ++i) {
-        updateDisplayMatrix(i);
+void Game::requestResume() {
+    {
+        std::lock_guard lock(resumeMutex);
+        isResumeRequested = true;
     }
-
-    window.clear();
-    window.draw(&displayMatrix[0], displayMatrix.size(), sf::Points);
-    window.display();
+    resumeSignal.notify_one();
 }
 
-void Game::endEpoch() {
-    epochCounter++;
-    computeFitness();
-    showStatistics();
-    try {
-        resetGeneration(computeNewGeneration());
-    } catch (const NoSurvivorsException &e) {
-        std::cout << e.what() << std::endl;
-        std::cout << "Game over!" << std::endl;
-        window.close();
-    }
-    isPaused = true;
+void Game::publish(std::optional<EpochStatistics> statistics, bool isGameOver) {
+    BoardSnapshot &snapshot = snapshots.back();
+    simulation.takeSnapshot(snapshot);
+    snapshot.statistics = std::move(statistics);
+    snapshot.isGameOver = isGameOver;
+    snapshots.publish();
 }
 
-void Game::menuDisplay() {
-    sf::Text message = sf::Text("Epoch: " + std::to_string(epochCounter) + " has ended! Press SPACE to spawn an evolved generation!", font);
+void Game::menuDisplay(const BoardSnapshot &snapshot) {
+    sf::Text message = sf::Text("Epoch: " + std::to_string(snapshot.epoch) + " has ended! Press SPACE to spawn an evolved generation!", font);
     message.setPosition(20, (float) height * Cell::CELL_SIZE);
     message.setCharacterSize(15);
     window.draw(message);
 }
 
 void Game::run() {
+    simulationThread = std::jthread([this](std::stop_token stopToken) {
+        simulate(stopToken);
+    });
     while (window.isOpen()) {
         sf::Event event{};
         while (window.pollEvent(event)) {
             if (event.type == sf::Event::Closed) {
                 window.close();
+            } else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Space) {
+                // only heard by the simulation while it waits at the end of an epoch
+                requestResume();
             }
         }
-        menuDisplay();
-        if (!isPaused) {
-            sf::Time elapsed = clock.getElapsedTime(); // get the elapsed time since the last call to getElapsedTime()
-            if (elapsed.asMilliseconds() >= EPOCH_DURATION) {
-                endEpoch();
-            } else {
-                display();
-            }
+        snapshots.update();
+        const BoardSnapshot &snapshot = snapshots.front();
+        if (snapshot.isGameOver) {
+            window.close();
+            break;
+        }
+        window.clear();
+        drawBoard(snapshot);
+        menuDisplay(snapshot);
+        if (snapshot.statistics) {
+            showStatistics(*snapshot.statistics);
         } else {
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space)) {
-                isPaused = false;
-                clock.restart();
-            }
+            showTimings(snapshot);
         }
         window.display();
     }
+    simulationThread.request_stop();
+    simulationThread.join();
 }
 
-void Game::display() {
-    window.clear();
-    displayMatrix.clear();
-    displayMatrix.resize(width * height * Cell::CELL_SIZE * Cell::CELL_SIZE);
-    for (int i = 0; i < width * height; i++) {
-        if (board[i] != nullptr) {
-            updateDisplayMatrix(i);
-            auto individual = dynamic_pointer_cast<Individual>(board[i]);
-            if (individual != nullptr) {
-                try {
-                    int coords = findFoodInRange(individual, individual->getVision());
-                    if (!std::dynamic_pointer_cast<Individual>(futureBoard[coords])) {
-                        futureBoard[coords] = individual;
-                        individual->setCoords(coords / width, coords % width);
-                        individual->eat();
-                    }
-                } catch (const NoFoodException&) {
-                    individual->move();
-                    int newPosition = individual->getPosition();
-                    try {
-                        checkCoordinates(newPosition);
-                        if (auto individualFound = dynamic_pointer_cast<Individual>(futureBoard[newPosition])) {
-                            try {
-                                handleInteraction(individual, individualFound);
-                            } catch (const InvalidFightingOutcomeException& e) {
-                                std::cout << e.what() << std::endl;
-                            }
-                        } else {
-                            futureBoard[newPosition] = individual;
-                        }
-                    } catch (const InvalidIndividualPositionException&) {}
-                }
-            } else {
-                auto individualEaten = dynamic_pointer_cast<Individual>(futureBoard[i]);
-                if (!individualEaten) {
-                    futureBoard[i] = board[i];
-                }
-            }
-        }
-    }
-    window.draw(&displayMatrix[0], displayMatrix.size(), sf::Points);
-    board = futureBoard;
-    futureBoard.clear();
-    futureBoard.resize(width * height);
+void Game::drawBoard(const BoardSnapshot &snapshot) {
+    auto timer = renderTimers.time(RENDERING_PHASE);
+    updateFrame(snapshot);
+    window.draw(frameSprite);
 }
 
-Game::Game() : width(MAX_X),
-               height(MAX_Y) {
-    currentGeneration[KEYSTONE_TYPE] = promptUser("[YELLOW] Specify the desired number of Keystone's (no special abilities, but can sustain on a small quantity of food):", 0, 600);
-    currentGeneration[CLAIRVOYANT_TYPE] = promptUser("[BLUE] Specify the desired number of Clairvoyant's (can spot food from afar):", 0, 600);
-    currentGeneration[REDBULL_TYPE] = promptUser("[RED] Specify the desired number of RedBull's (fast on their feet, but very hungry!)", 0, 600);
-    currentGeneration[ASCENDANT_TYPE] = promptUser("[CYAN] Specify the desired number of Ascendant's (become much stronger once they encounter food for the first time", 0, 600);
-    currentGeneration[SUITOR_TYPE] = promptUser("[PINK] Specify the desired number of Suitor's - each Suitor wants to mate with a specific breed of Individuals. The type of Suitor gets chosen randomly at spawn time.",
-                                                0, 600);
-    quantityOfFood = promptUser("[DARK GREEN] Specify the desired quantity of food", 0, 2500);
-    clock.restart();
+Game::Game(const std::string &speciesPath, const std::string &fightingPath) : simulation(promptViewerConfig(speciesPath, fightingPath)),
+               width(simulation.getWidth()),
+               height(simulation.getHeight()) {
     window.create(sf::VideoMode(width * Cell::CELL_SIZE, height * Cell::CELL_SIZE + BOTTOM_BAR_HEIGHT), "Game of Life");
 
-    killedIndividuals = 0;
-    matingsOccurred = 0;
     // testing to see why cppcheck fails
     // although Ascendant->getHunger() gets called, for some reason cppcheck thinks it's not unless I do this
-    std::shared_ptr<Ascendant> ascendant = std::make_shared<Ascendant>(0, 0);
-    std::cout << ascendant->getHunger() << std::endl;
+    EntityStore scratch;
+    Ascendant *ascendant = CellFactory::createAscendant(scratch, 0, 0);
+    logDebug("Ascendant hunger: ", ascendant->getHunger());
 
     try {
         initializeFont(font);
     } catch (const FontLoadingException &e) {
-        std::cout << e.what() << std::endl;
+        logError(e.what());
     }
 
-    epochCounter = 0;
-    resetBoard();
+    initializeDisplay();
+    // drawing is cheap now, the display decides how often it happens
     window.setVerticalSyncEnabled(true);
-    window.setFramerateLimit(15);
-}
-
-void Game::generateCells() {
-    board.clear();
-    futureBoard.clear();
-    board.resize(width * height);
-    futureBoard.resize(width * height);
-    int lowerBound = 0;
-
-    std::cout << getTotalIndividuals() << std::endl;
-
-    auto randomPositions = generateRandomArray(getTotalIndividuals() + quantityOfFood, 0, width * height);
-
-    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != INDIVIDUAL_TYPE_END; type = (IndividualType)(type + 1)) {
-        for (int i = lowerBound; i < lowerBound + currentGeneration[type]; i++) {
-            try {
-                board[randomPositions[i]] = CellFactory::createIndividual(randomPositions[i] / height, randomPositions[i] % height, type);
-            } catch (InvalidIndividualTypeException &e) {
-                std::cout << e.what() << std::endl;
-            }
-        }
-        lowerBound += currentGeneration[type];
-    }
-
-    for (int i = lowerBound; i < lowerBound + quantityOfFood; i++) {
-        board[randomPositions[i]] = CellFactory::createFood(randomPositions[i] / height, randomPositions[i] % height);
-    }
-
 }
 
 void Game::initializeDisplay() {
-    displayMatrix.resize(width * height * Cell::CELL_SIZE * Cell::CELL_SIZE);
-    for (int i = 0; i < height * Cell::CELL_SIZE; ++i) {
-        for (int j = 0; j < width * Cell::CELL_SIZE; ++j) {
-            displayMatrix[i * width * Cell::CELL_SIZE + j] = sf::Vertex(sf::Vector2f((float)j, (float)i), sf::Color::Black);
-        }
-    }
+    frame.create(width, height, sf::Color::Black);
+    frameTexture.create(width, height);
+    frameTexture.update(frame);
+    frameSprite.setTexture(frameTexture, true);
+    frameSprite.setScale((float) Cell::CELL_SIZE, (float) Cell::CELL_SIZE);
 }
 
-void Game::updateDisplayMatrix(int i, sf::Color color) {
-    int x = i / height;
-    int y = i % height;
-    for (int j = 0; j < Cell::CELL_SIZE; ++j) {
-        for (int k = 0; k < Cell::CELL_SIZE; ++k) {
-            displayMatrix[(x * Cell::CELL_SIZE + j) * width * Cell::CELL_SIZE + y * Cell::CELL_SIZE + k] =
-                    sf::Vertex(sf::Vector2f((float)(y * Cell::CELL_SIZE + k), (float)(x * Cell::CELL_SIZE + j)), color);
-        }
-    }
-}
-
-void Game::updateDisplayMatrix(int i) {
-    if (board[i] == nullptr) {
-        updateDisplayMatrix(i, sf::Color::Black);
-    } else {
-        updateDisplayMatrix(i, board[i]->getColor());
+void Game::updateFrame(const BoardSnapshot &snapshot) {
+    if (snapshot.width != width || snapshot.height != height) {
+        // nothing has been published yet
+        return;
     }
-}
-
-int Game::findFreeSpot(int pos, int radius) {
-    int x = pos / height;
-    int y = pos % height;
-    // check in the circle centered at (x, y) with radius i
-    for (int j = x - radius; j <= x + radius; ++j) {
-        for (int k = y - radius; k <= y + radius; ++k) {
-            int newPos = j * height + k;
-            if (newPos >= 0 && newPos < width * height && futureBoard[newPos] == nullptr) {
-                return newPos;
+    const auto *pixels = frame.getPixelsPtr();
+    // consecutive dirty rows are sent to the texture together; the extra row past the board flushes the last run
+    int firstDirtyRow = -1;
+    for (int y = 0; y <= height; ++y) {
+        bool isDirty = false;
+        for (int x = 0; y < height && x < width; ++x) {
+            sf::Color color = toSfColor(snapshot.colors[y * width + x]);
+            if (frame.getPixel(x, y) != color) {
+                frame.setPixel(x, y, color);
+                isDirty = true;
             }
         }
-    }
-    throw RanOutOfEmptyPositionsException(x, y, radius);
-}
-
-
-int Game::findFoodInRange(const std::shared_ptr<Individual>& individual, int radius) {
-    int position = individual->getPosition();
-    int x = position / height;
-    int y = position % height;
-    // check in the circle centered at (x, y) with radius i
-    for (int j = x - radius; j <= x + radius; ++j) {
-        for (int k = y - radius; k <= y + radius; ++k) {
-            int newPos = j * height + k;
-            if (newPos >= 0 && newPos < width * height && board[newPos] != nullptr) {
-                auto food = std::dynamic_pointer_cast<Food>(board[newPos]);
-                if (food && !std::dynamic_pointer_cast<Individual>(futureBoard[newPos])) {
-                    return newPos;
-                }
-            }
+        if (isDirty && firstDirtyRow == -1) {
+            firstDirtyRow = y;
+        } else if (!isDirty && firstDirtyRow != -1) {
+            frameTexture.update(pixels + 4 * firstDirtyRow * width, width, y - firstDirtyRow, 0, firstDirtyRow);
+            firstDirtyRow = -1;
         }
     }
-    throw NoFoodException(x, y);
-}
-
-int Game::getTotalIndividuals() const {
-    int totalIndividuals = 0;
-    for (auto individualType = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); individualType != INDIVIDUAL_TYPE_END; individualType = (IndividualType)(individualType + 1)) {
-        totalIndividuals += currentGeneration.at(individualType);
-    }
-    return totalIndividuals;
-}
-
-int Game::getTotalSurvivalRate() const {
-    int totalSurvivalRate = 0;
-    for (auto individualType = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); individualType != INDIVIDUAL_TYPE_END; individualType = (IndividualType)(individualType + 1)) {
-        totalSurvivalRate += survivorMap.at(individualType);
-    }
-    return (int) (100.0 * totalSurvivalRate / getTotalIndividuals());
 }
 
-void Game::showStatistics() {
+void Game::showStatistics(const EpochStatistics &statistics) {
     sf::Text text;
     text.setFont(font);
     text.setCharacterSize(12);
     text.setFillColor(sf::Color::White);
     text.setPosition(20, (float)height * Cell::CELL_SIZE + 20);
-    std::string output;
-
-    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != INDIVIDUAL_TYPE_END; type = IndividualType(type + 1)) {
-        output += individualTypeToString(type) + ": " +
-                  getPercentage(survivorMap[type], currentGeneration[type]) + " survived. "
-                  "( " + std::to_string(survivorMap[type]) + " / " + std::to_string(currentGeneration[type]) + ")\n";
-    }
-
-    for (auto type = (FightingStrategyType)(FIGHTING_TYPE_BEGIN + 1); type != FIGHTING_TYPE_END; type = FightingStrategyType(type + 1)) {
-        output += fightingStrategyTypeToString(type) + ": " + getPercentage(fightingStrategyMap[type], getTotalSurvivors()) + "   ";
-    }
-
-    output += "\nTotal survival rate: " + std::to_string(getTotalSurvivalRate()) + "%\n";
-    output += "Total offspring produced: " + std::to_string(matingsOccurred) + ". Total individuals killed: " + std::to_string(killedIndividuals) + ".\n";
-    text.setString(output);
+    std::ostringstream output;
+    output << statistics;
+    text.setString(output.str());
     window.draw(text);
 }
 
-void Game::resetGeneration(std::unordered_map<IndividualType, int> generation) {
-    killedIndividuals = 0;
-    matingsOccurred = 0;
-    for (auto individualType = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); individualType != INDIVIDUAL_TYPE_END; individualType = (IndividualType)(individualType + 1)) {
-        currentGeneration[individualType] = generation[individualType];
-        survivorMap[individualType] = 0;
+void Game::showTimings(const BoardSnapshot &snapshot) {
+    std::ostringstream output;
+    output << std::fixed << std::setprecision(1);
+    output << std::left << std::setw(14) << "phase (us)" << std::right << std::setw(9) << "p50" << std::setw(9) << "p95" << std::setw(9) << "p99" << "\n";
+    for (auto phase = (TickPhase)(TICK_PHASE_BEGIN + 1); phase != TICK_PHASE_END; phase = (TickPhase)(phase + 1)) {
+        PhaseStatistics statistics = phase == RENDERING_PHASE ? renderTimers.summarize(phase) : snapshot.phaseTimes[phase];
+        output << std::left << std::setw(14) << tickPhaseToString(phase) << std::right << std::setw(9) << statistics.p50
+               << std::setw(9) << statistics.p95 << std::setw(9) << statistics.p99 << "\n";
     }
-    for (auto fightingStrategyType = (FightingStrategyType)(FIGHTING_TYPE_BEGIN + 1); fightingStrategyType != FIGHTING_TYPE_END; fightingStrategyType = (FightingStrategyType)(fightingStrategyType + 1)) {
-        fightingStrategyMap[fightingStrategyType] = 0;
-    }
-    resetBoard();
-}
-
-void Game::resetBoard() {
-    survivorMap.clear();
-    generateCells();
-    initializeDisplay();
-}
-
-
-template <typename T>
-bool Game::checkSuitor(std::shared_ptr<Individual> a, std::shared_ptr<T> b) {
-    if (dynamic_pointer_cast<Suitor<T>>(a)) {
-        mate<T>(b, dynamic_pointer_cast<Suitor<T>>(a));
-        return true;
-    }
-    return false;
+    sf::Text text;
+    text.setFont(font);
+    text.setCharacterSize(12);
+    text.setFillColor(sf::Color::White);
+    text.setPosition(20, (float)height * Cell::CELL_SIZE + 20);
+    text.setString(output.str());
+    window.draw(text);
 }
 
 Game::~Game() {
-    std::cout << "Destructor called\n";
+    logDebug("Destructor called");
 }
 
 std::ostream &operator<<(std::ostream &os, const Game &game) {
-    os << " width: " << game.width << " height: " << game.height << " numberOfIndividuals: " << game.getTotalIndividuals()
-       << " numberOfFood: " << game.quantityOfFood;
+    os << game.simulation;
     return os;
 }
-
-bool Game::performSuitorCheck(const std::shared_ptr<Individual>& individual, const std::shared_ptr<Individual>& suitorCandidate) {
-    // call check suitor for individual's type
-    if (checkSuitor<Clairvoyant>(suitorCandidate, dynamic_pointer_cast<Clairvoyant>(individual))) {
-        return true;
-    }
-    if (checkSuitor<RedBull>(suitorCandidate, dynamic_pointer_cast<RedBull>(individual))) {
-        return true;
-    }
-    if (checkSuitor<Keystone>(suitorCandidate, dynamic_pointer_cast<Keystone>(individual))) {
-        return true;
-    }
-    if (checkSuitor<Ascendant>(suitorCandidate, dynamic_pointer_cast<Ascendant>(individual))) {
-        return true;
-    }
-    return false;
-}
-
-void Game::handleInteraction(const std::shared_ptr<Individual>& individual1, const std::shared_ptr<Individual>& individual2) {
-    if (individual1->getFightingStrategy() == nullptr && individual2->getFightingStrategy() == nullptr) {
-        handleFightingOutcome(individual1, individual2, LIVE_LIVE);
-    } else if (individual1->getFightingStrategy() == nullptr) {
-        performSuitorCheck(individual2, individual1);
-    } else if (individual2->getFightingStrategy() == nullptr) {
-        performSuitorCheck(individual1, individual2);
-    } else {
-        handleFightingOutcome(individual1, individual2, individual1->fight(individual2));
-    }
-}
-
-void Game::handleFightingOutcome(const std::shared_ptr<Individual>& individual1, const std::shared_ptr<Individual>& individual2, FightingOutcome fightingOutcome) {
-    switch (fightingOutcome) {
-        case LIVE_LIVE: {
-            try {
-                int freePosition = findFreeSpot(individual1->getPosition(), 5);
-                futureBoard[freePosition] = individual1;
-            } catch (const RanOutOfEmptyPositionsException &e) {
-                std::cout << e.what() << std::endl;
-            }
-            break;
-        }
-        case LIVE_DIE: {
-            std::cout << "Individual killed.\n";
-            killedIndividuals++;
-            futureBoard[individual1->getPosition()] = individual1;
-            break;
-        }
-        case DIE_LIVE: {
-            std::cout << "Individual killed.\n";
-            killedIndividuals++;
-            futureBoard[individual1->getPosition()] = individual2;
-            break;
-        }
-        default:
-            throw InvalidFightingOutcomeException();
-    }
-}
-
-int Game::getTotalSurvivors() {
-    int totalSurvivors = 0;
-    for (auto individualType = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); individualType != INDIVIDUAL_TYPE_END; individualType = (IndividualType)(individualType + 1)) {
-        totalSurvivors += survivorMap[individualType];
-    }
-    return totalSurvivors;
-}
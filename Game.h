@@ -1,85 +1,72 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
-#include <set>
-#include <vector>
-#include <unordered_set>
-#include <unordered_map>
-#include <utility>
-#include <memory>
-#include "Individual.h"
-#include "Utils.h"
-#include "Food.h"
-#include "Cell.h"
-#include "Suitor.h"
-#include "IndividualType.h"
-#include "FightingStrategyType.h"
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include "Simulation.h"
+#include "BoardSnapshot.h"
+#include "TripleBuffer.h"
+#include "PhaseTimers.h"
+#include "EpochStatistics.h"
+#include "Color.h"
 
 
-// altfel crapa
-template <typename T> class Suitor;
-
+// SFML viewer over the simulation core
+// the simulation ticks on its own thread at a fixed rate and hands snapshots of the board over to the window's thread,
+// which draws the newest one every frame and keeps handling input whatever the simulation is doing
 class Game {
 public:
-    static Game &getInstance();
+    // the files are only read by the first call, see SpeciesRegistry and FightingRules;
+    // throws InvalidSpeciesException, InvalidFightingRulesException or ResourceLoadException
+    static Game &getInstance(const std::string &speciesPath = "", const std::string &fightingPath = "");
     void run();
     Game(const Game &other) = delete;
     Game& operator=(const Game &other) = delete;
     ~Game();
     friend std::ostream &operator<<(std::ostream &os, const Game &game);
-    template <typename T>
-    bool checkSuitor(std::shared_ptr<Individual> a, std::shared_ptr<T> b);
 
 private:
-    int killedIndividuals;
-    int matingsOccurred;
-    std::unordered_map<IndividualType, int> survivorMap;
-    std::unordered_map<FightingStrategyType, int> fightingStrategiesSurvivorMap;
-    std::vector<std::shared_ptr<Cell>> board;
-    std::vector<std::shared_ptr<Cell>> futureBoard;
-    std::vector<sf::Vertex> displayMatrix;
-    std::unordered_map<IndividualType, int> currentGeneration;
-    std::unordered_map<FightingStrategyType, int> currentFightingStrategies;
-    std::unordered_map<FightingStrategyType, int> fightingStrategyMap;
+    // only the simulation thread touches it once run() has started
+    Simulation simulation;
+    TripleBuffer<BoardSnapshot> snapshots;
+    // one pixel per cell; the sprite scales it up to CELL_SIZE x CELL_SIZE on screen
+    sf::Image frame;
+    sf::Texture frameTexture;
+    sf::Sprite frameSprite;
+    // rendering is timed here, on the window's thread; the simulation times its own phases
+    PhaseTimers renderTimers;
     int width, height;
-    int quantityOfFood;
-    sf::Clock clock;
     sf::Font font;
     sf::RenderWindow window;
+    // the simulation thread waits here at the end of an epoch until the player asks for the next generation
+    std::mutex resumeMutex;
+    std::condition_variable_any resumeSignal;
+    bool isResumeRequested = false;
+    // declared last, so that it is stopped and joined before anything it uses goes away
+    std::jthread simulationThread;
 
-    Game();
-    void generateCells();
-    void display();
+    Game(const std::string &speciesPath, const std::string &fightingPath);
+    void simulate(std::stop_token stopToken);
+    // waits for SPACE, false if the game is closing instead
+    bool waitForResume(std::stop_token stopToken);
+    void publish(std::optional<EpochStatistics> statistics = std::nullopt, bool isGameOver = false);
+    void requestResume();
+    void drawBoard(const BoardSnapshot &snapshot);
     void initializeDisplay();
-    void updateDisplayMatrix(int i);
-    void updateDisplayMatrix(int i, sf::Color color);
-    bool isPaused = false;
-    int epochCounter = 0;
-    static const int EPOCH_DURATION = 2000;
+    // repaints the cells whose color changed and uploads only the rows that contain them
+    void updateFrame(const BoardSnapshot &snapshot);
     static const int BOTTOM_BAR_HEIGHT = 150;
-    void endEpoch();
-    void menuDisplay();
-    void computeFitness();
-    const static std::unordered_map<int, std::string> raceDict;
-    void showStatistics();
-    int findFoodInRange(const std::shared_ptr<Individual>&, int radius);
-    std::unordered_map<IndividualType, int> computeNewGeneration();
-    void resetBoard();
-    int getTotalSurvivalRate() const;
-
-    template <typename K>
-    void mate(std::shared_ptr<K> individual, std::shared_ptr<Suitor<K>> suitor);
-    int findFreeSpot(int pos, int radius);
-
-    template <typename T>
-    void produceOffspring(int pos);
-    void assertFitnessOfIndividual(const std::shared_ptr<Individual>& individual);
-    void resetGeneration(std::unordered_map<IndividualType, int> generation);
-    int getTotalIndividuals() const;
-    bool performSuitorCheck(const std::shared_ptr<Individual>& individual, const std::shared_ptr<Individual>& suitorCandidate);
-    void handleInteraction(const std::shared_ptr<Individual>& individual1, const std::shared_ptr<Individual>& individual2);
-    void handleFightingOutcome(const std::shared_ptr<Individual> &individual1, const std::shared_ptr<Individual> &individual2, FightingOutcome fightingOutcome);
-
-    int getTotalSurvivors();
+    // an epoch used to last 2 seconds at 15 frames per second, the simulation keeps that pace
+    constexpr static std::chrono::microseconds TICK_INTERVAL{1000000 / 15};
+    void menuDisplay(const BoardSnapshot &snapshot);
+    void showStatistics(const EpochStatistics &statistics);
+    // p50/p95/p99 of every phase, shown in the bottom bar while an epoch runs
+    void showTimings(const BoardSnapshot &snapshot);
 };
+
+sf::Color toSfColor(const Color &color);
+void initializeFont(sf::Font& font);
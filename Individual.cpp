@@ -1,48 +1,52 @@
 
 #include "Individual.h"
-#include <memory>
-#include <utility>
+#include <algorithm>
 #include "Utils.h"
-#include "Exceptions.h"
-#include "DefensiveFightingStrategy.h"
-#include "OffensiveFightingStrategy.h"
-
-Individual::Individual(int x, int y) : x(x), y(y), health(0), direction(randomIntegerFromInterval(0, NUMBERS_OF_DIRECTIONS - 1)), speed(DEFAULT_SPEED) {
-    if (randomIntegerFromInterval(0, 1) == 0) {
-        fightingStrategy = std::make_shared<OffensiveFightingStrategy>();
-    } else {
-        fightingStrategy = std::make_shared<DefensiveFightingStrategy>();
-    }
-}
+#include "Random.h"
+
+Individual::Individual(EntityStore &store, EntityStore::Id id) : Cell(INDIVIDUAL_KIND), store(&store), id(id) {}
 
 std::ostream &operator<<(std::ostream &os, const Individual &individual) {
-    os << "INDIVIDUAL - x: " << individual.x << " " << "y: " << individual.y << "\n";
+    os << "INDIVIDUAL - x: " << individual.store->x(individual.id) << " " << "y: " << individual.store->y(individual.id) << "\n";
     return os;
 }
 
 void Individual::eat() {
-    health += 1;
+    store->health(id) += 1;
+    // the first meal switches a species with two phases to the second one
+    store->markEaten(id);
 }
 
 void Individual::move() {
-    x += getSpeed() * dirX[direction];
-    y += getSpeed() * dirY[direction];
+    move(getSpeed());
+}
+
+void Individual::move(int speed) {
+    int &x = store->x(id);
+    int &y = store->y(id);
+    int &direction = store->direction(id);
+    x += speed * dirX[direction];
+    y += speed * dirY[direction];
     if (randomIntegerFromInterval(0, RESET_DIRECTION_SEED) == 0) {
         direction = randomIntegerFromInterval(0, NUMBERS_OF_DIRECTIONS - 1);
     }
-    try {
-        checkCoordinates(x, y);
-    } catch (const InvalidIndividualPositionException&) {
+    // walking off the board is an ordinary event, bring the individual back without throwing
+    int width = store->getWorldWidth();
+    int height = store->getWorldHeight();
+    if (!isInsideBoard(x, y, width, height)) {
+        // on worlds narrower than 4 * OFFSET, a quarter of the way in
+        int offsetX = std::min(OFFSET, width / 4);
+        int offsetY = std::min(OFFSET, height / 4);
         if (x < 0) {
-            x = OFFSET;
-        } else if (x > MAX_X) {
-            x = MAX_X - OFFSET;
+            x = offsetX;
+        } else if (x >= width) {
+            x = width - std::max(offsetX, 1);
         }
 
         if (y < 0) {
-            y = OFFSET;
-        } else if (y > MAX_Y) {
-            y = MAX_Y - OFFSET;
+            y = offsetY;
+        } else if (y >= height) {
+            y = height - std::max(offsetY, 1);
         }
     }
 }
@@ -50,68 +54,58 @@ void Individual::move() {
 
 
 bool Individual::operator==(const Individual &rhs) const {
-    return x == rhs.x &&
-           y == rhs.y &&
-           speed == rhs.speed &&
-           direction == rhs.direction &&
-           health == rhs.health &&
-           fightingStrategy.get() == rhs.fightingStrategy.get();
+    return store == rhs.store && id == rhs.id;
 }
 
 Individual::~Individual() = default;
 
 int Individual::getPosition() const {
-    return y * MAX_Y + x;
+    return store->y(id) * store->getWorldWidth() + store->x(id);
+}
+
+EntityStore::Id Individual::getId() const {
+    return id;
+}
+
+IndividualType Individual::getType() const {
+    return store->species(id);
 }
 
 int Individual::getVision() const {
-    return Individual::DEFAULT_VISION;
+    return store->traits(id).vision[store->hasEaten(id)];
 }
 
 int Individual::getHunger() const {
-    return Individual::DEFAULT_HUNGER;
+    return store->traits(id).hunger;
 }
 
 int Individual::getSpeed() const {
-    return Individual::DEFAULT_SPEED;
+    return store->traits(id).speed[store->hasEaten(id)];
 }
 
 bool Individual::checkIfAlive() const {
-    return health >= getHunger();
+    return store->health(id) >= getHunger();
 }
 
 void Individual::setCoords(int xx, int yy) {
-    x = xx;
-    y = yy;
+    store->x(id) = xx;
+    store->y(id) = yy;
 }
 
-std::shared_ptr<FightingStrategy> Individual::getFightingStrategy() {
-    return fightingStrategy;
+FightingStrategyType Individual::getFightingStrategy() const {
+    return store->strategy(id);
 }
 
-FightingOutcome Individual::fight(const std::shared_ptr<Individual>& individual) {
-    return fightingStrategy->fight(individual->getFightingStrategy());
+Color Individual::getOwnColor() const {
+    return store->traits(id).color;
 }
 
-Individual::Individual(int x, int y, std::shared_ptr<FightingStrategy> fightingStrategy) : Individual(x, y) {
-    this->fightingStrategy = std::move(fightingStrategy);
+Color Individual::getColor() const {
+    // suitors do not fight, they only show their species
+    FightingStrategyType strategy = store->strategy(id);
+    return strategy == LOVER_TYPE ? getOwnColor() : colorMixer(getOwnColor(), store->getFighting()[strategy].color);
 }
 
-sf::Color Individual::getColor() const {
-    return fightingStrategy ? colorMixer(getOwnColor(), fightingStrategy->getColor()) : getOwnColor();
-}
-
-Individual::Individual(const Individual &other) : x(other.x), y(other.y), health(other.health), direction(other.direction), speed(other.speed), fightingStrategy(other.fightingStrategy->clone()) {}
+Individual::Individual(const Individual &other) = default;
 
-Individual &Individual::operator=(const Individual &other) {
-    if (this == &other) {
-        return *this;
-    }
-    x = other.x;
-    y = other.y;
-    speed = other.speed;
-    direction = other.direction;
-    health = other.health;
-    fightingStrategy = other.fightingStrategy->clone();
-    return *this;
-}
\ No newline at end of file
+Individual &Individual::operator=(const Individual &other) = default;
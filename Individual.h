@@ -1,40 +1,42 @@
 #pragma once
 
 #include <ostream>
-#include <memory>
 #include "Cell.h"
-#include "FightingStrategy.h"
+#include "EntityStore.h"
 
-// abstract class since it doesn't implement getColor()
+// a view over one individual of an EntityStore; the state itself lives in the store, the traits of its species
+// in the store's SpeciesRegistry and its strategy in the store's FightingRules, so that a species or a strategy
+// read from a file needs no class of its own
 class Individual : public Cell {
 public:
-    Individual(int x, int y, std::shared_ptr<FightingStrategy> fightingStrategy);
-    Individual(int x, int y);
+    Individual(EntityStore &store, EntityStore::Id id);
     Individual(const Individual &other);
     Individual& operator=(const Individual &other);
     ~Individual() override;
     friend std::ostream &operator<<(std::ostream &os, const Individual &individual);
     bool operator==(const Individual &rhs) const;
-    [[nodiscard]] virtual int getSpeed() const;
-    [[nodiscard]] virtual int getHunger() const;
-    [[nodiscard]] virtual int getVision() const;
+    // the traits of the species, in the phase the individual is in
+    [[nodiscard]] int getSpeed() const;
+    [[nodiscard]] int getHunger() const;
+    [[nodiscard]] int getVision() const;
     [[nodiscard]] int getPosition() const;
-    std::shared_ptr<FightingStrategy> getFightingStrategy();
-    FightingOutcome fight(const std::shared_ptr<Individual>& individual);
+    [[nodiscard]] EntityStore::Id getId() const;
+    [[nodiscard]] IndividualType getType() const;
+    // LOVER_TYPE for suitors; how a strategy fights is up to the FightingRules of the store
+    [[nodiscard]] FightingStrategyType getFightingStrategy() const;
     void setCoords(int x, int y);
-    virtual void eat();
+    void eat();
     void move();
+    // with the speed already known, for the loops over a single species
+    void move(int speed);
     [[nodiscard]] bool checkIfAlive() const;
-    [[nodiscard]] virtual sf::Color getOwnColor() const = 0;
-    [[nodiscard]] sf::Color getColor() const override;
+    [[nodiscard]] Color getOwnColor() const;
+    [[nodiscard]] Color getColor() const override;
+
+protected:
+    EntityStore *store;
+    EntityStore::Id id;
 
 private:
-    int x, y, health, direction, speed;
-    const static int DEFAULT_HUNGER = 1;
-    const static int DEFAULT_SPEED = 1;
-    const static int DEFAULT_VISION = 2;
     const static int RESET_DIRECTION_SEED = 15;
-    const static int NUMBERS_OF_DIRECTIONS = 8;
-
-    std::shared_ptr<FightingStrategy> fightingStrategy;
-};
\ No newline at end of file
+};
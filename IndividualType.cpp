@@ -15,9 +15,8 @@ std::string individualTypeToString(IndividualType type) {
             return "RedBull";
         case INDIVIDUAL_TYPE_BEGIN:
             return "Begin Placeholder";
-        case INDIVIDUAL_TYPE_END:
-            return "End Placeholder";
         default:
-            return "Invalid Individual Type";
+            // the species from INDIVIDUAL_TYPE_END on are named by their SpeciesRegistry, only the number is known here
+            return "species " + std::to_string(type);
     }
 }
\ No newline at end of file
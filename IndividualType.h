@@ -2,9 +2,11 @@
 #ifndef OOP_INDIVIDUALTYPE_H
 #define OOP_INDIVIDUALTYPE_H
 
+#include <cstdint>
 #include <string>
 
-enum IndividualType {
+// the species built into the simulator; those read from a species file take the values from INDIVIDUAL_TYPE_END on, see SpeciesRegistry
+enum IndividualType : std::uint8_t {
     INDIVIDUAL_TYPE_BEGIN,
     CLAIRVOYANT_TYPE,
     ASCENDANT_TYPE,
@@ -14,6 +16,7 @@ enum IndividualType {
     INDIVIDUAL_TYPE_END
 };
 
+// the name of a built-in species; the others go by their number, their names are looked up in the SpeciesRegistry of the simulation
 std::string individualTypeToString(IndividualType type);
 
 #endif //OOP_INDIVIDUALTYPE_H
@@ -1,7 +1,3 @@
 #include "Keystone.h"
 
-Keystone::Keystone(int x, int y) : Individual(x, y) {}
-
-sf::Color Keystone::getOwnColor() const {
-    return sf::Color::Yellow;
-}
\ No newline at end of file
+Keystone::Keystone(EntityStore &store, EntityStore::Id id) : Individual(store, id) {}
\ No newline at end of file
@@ -7,8 +7,9 @@
 
 class Keystone : public Individual {
 public:
-    Keystone(int x, int y);
-    [[nodiscard]] sf::Color getOwnColor() const override;
+    const static IndividualType TYPE = KEYSTONE_TYPE;
+
+    Keystone(EntityStore &store, EntityStore::Id id);
 };
 
 
@@ -0,0 +1,16 @@
+#include "LogLevel.h"
+
+std::string logLevelToString(LogLevel level) {
+    switch (level) {
+        case DEBUG_LEVEL:
+            return "DEBUG";
+        case INFO_LEVEL:
+            return "INFO";
+        case WARNING_LEVEL:
+            return "WARNING";
+        case ERROR_LEVEL:
+            return "ERROR";
+        default:
+            return "UNKNOWN";
+    }
+}
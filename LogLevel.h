@@ -0,0 +1,17 @@
+#ifndef OOP_LOGLEVEL_H
+#define OOP_LOGLEVEL_H
+
+#include <string>
+
+enum LogLevel {
+    LOG_LEVEL_BEGIN,
+    DEBUG_LEVEL,
+    INFO_LEVEL,
+    WARNING_LEVEL,
+    ERROR_LEVEL,
+    LOG_LEVEL_END
+};
+
+std::string logLevelToString(LogLevel level);
+
+#endif //OOP_LOGLEVEL_H
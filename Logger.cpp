@@ -0,0 +1,118 @@
+#include "Logger.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+Logger &Logger::getInstance() {
+    static Logger instance;
+    return instance;
+}
+
+Logger::Logger() : output(std::cout), slots(std::make_unique<Slot[]>(CAPACITY)) {
+    for (std::size_t i = 0; i < CAPACITY; ++i) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    writer = std::jthread([this](std::stop_token stopToken) {
+        writeLoop(stopToken);
+    });
+}
+
+Logger::~Logger() {
+    writer.request_stop();
+    // the writer drains what is left before it returns
+    writer.join();
+}
+
+void Logger::setLevel(LogLevel newLevel) {
+    level.store(newLevel, std::memory_order_relaxed);
+}
+
+LogLevel Logger::getLevel() const {
+    return level.load(std::memory_order_relaxed);
+}
+
+void Logger::flush() {
+    std::uint64_t target = head.load(std::memory_order_acquire);
+    wake.notify_one();
+    std::uint64_t done = written.load(std::memory_order_acquire);
+    while (done < target) {
+        written.wait(done, std::memory_order_acquire);
+        done = written.load(std::memory_order_acquire);
+    }
+}
+
+void Logger::push(LogLevel messageLevel, char *text, std::size_t length) {
+    if (length > TEXT_SIZE) {
+        length = TEXT_SIZE;
+        std::memcpy(text + length - CUT_MARK.size(), CUT_MARK.data(), CUT_MARK.size());
+    }
+    std::uint64_t position = head.load(std::memory_order_relaxed);
+    Slot *slot;
+    while (true) {
+        slot = &slots[position % CAPACITY];
+        std::uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence == position) {
+            if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (sequence < position) {
+            // the writer has not freed this slot yet, the whole buffer is waiting to be written out
+            wake.notify_one();
+            std::this_thread::yield();
+            position = head.load(std::memory_order_relaxed);
+        } else {
+            // another thread claimed this position first
+            position = head.load(std::memory_order_relaxed);
+        }
+    }
+    slot->level = messageLevel;
+    slot->length = (std::uint16_t) length;
+    std::memcpy(slot->text, text, length);
+    slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+bool Logger::hasPending() const {
+    return slots[tail % CAPACITY].sequence.load(std::memory_order_acquire) == tail + 1;
+}
+
+std::size_t Logger::drain() {
+    std::size_t count = 0;
+    while (hasPending()) {
+        Slot &slot = slots[tail % CAPACITY];
+        output << '[' << logLevelToString(slot.level) << "] ";
+        output.write(slot.text, slot.length);
+        output << '\n';
+        slot.sequence.store(tail + CAPACITY, std::memory_order_release);
+        tail++;
+        count++;
+    }
+    if (count > 0) {
+        output.flush();
+        written.store(tail, std::memory_order_release);
+        written.notify_all();
+    }
+    return count;
+}
+
+void Logger::writeLoop(std::stop_token stopToken) {
+    while (!stopToken.stop_requested()) {
+        if (drain() == 0) {
+            // producers never take the mutex, a wake-up that slips past is caught by the timeout
+            std::unique_lock lock(wakeMutex);
+            wake.wait_for(lock, stopToken, IDLE_INTERVAL, [this] { return hasPending(); });
+        }
+    }
+    drain();
+}
+
+void Logger::append(char *&out, const char *end, std::string_view text) {
+    std::size_t length = std::min(text.size(), (std::size_t) (end - out));
+    std::memcpy(out, text.data(), length);
+    out += length;
+}
+
+void Logger::append(char *&out, const char *end, char character) {
+    if (out != end) {
+        *out++ = character;
+    }
+}
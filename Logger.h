@@ -0,0 +1,133 @@
+#ifndef OOP_LOGGER_H
+#define OOP_LOGGER_H
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+#include "LogLevel.h"
+
+// calls below this level are compiled out entirely, set with -DMIN_LOG_LEVEL=INFO (or WARNING, ERROR) when configuring
+#ifdef OOP_MIN_LOG_LEVEL
+constexpr LogLevel MIN_COMPILED_LOG_LEVEL = OOP_MIN_LOG_LEVEL;
+#else
+constexpr LogLevel MIN_COMPILED_LOG_LEVEL = DEBUG_LEVEL;
+#endif
+
+// event log of the whole program
+// a message is formatted on the caller's stack and copied into a slot of a fixed ring buffer,
+// and a background thread writes the slots out in order, flushing once per batch instead of once per line;
+// claiming a slot is a single compare and swap, so the tick never waits for a lock or for the output
+// a message longer than a slot is cut short and ends with "..."; when the buffer is full the caller waits for the writer, nothing is lost
+class Logger {
+public:
+    static Logger &getInstance();
+    Logger(const Logger &other) = delete;
+    Logger& operator=(const Logger &other) = delete;
+    ~Logger();
+
+    // the message is the concatenation of the arguments: strings, characters and integers
+    template <LogLevel messageLevel, typename... Args>
+    void log(const Args &...args);
+    // messages below this level are dropped at run time, the compiled-out ones never get here
+    void setLevel(LogLevel newLevel);
+    [[nodiscard]] LogLevel getLevel() const;
+    // returns once everything logged before the call has been written, so the caller can write to the same output after it
+    void flush();
+
+private:
+    constexpr static std::size_t CAPACITY = 4096;
+    // room for an error naming a long path; with the header a slot takes five cache lines
+    constexpr static std::size_t TEXT_SIZE = 300;
+    // ends a message that did not fit in a slot
+    constexpr static std::string_view CUT_MARK = "...";
+    constexpr static std::chrono::milliseconds IDLE_INTERVAL{10};
+
+    struct alignas(64) Slot {
+        // the position this slot is ready for: claimable when it equals the write position, readable at one more
+        std::atomic<std::uint64_t> sequence;
+        LogLevel level;
+        std::uint16_t length;
+        char text[TEXT_SIZE];
+    };
+
+    std::ostream &output;
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<LogLevel> level{DEBUG_LEVEL};
+    // next position to claim, shared by every logging thread
+    alignas(64) std::atomic<std::uint64_t> head{0};
+    // next position to write out, only the writer touches it
+    alignas(64) std::uint64_t tail = 0;
+    // positions written out so far, what flush() waits on
+    std::atomic<std::uint64_t> written{0};
+    std::mutex wakeMutex;
+    std::condition_variable_any wake;
+    // declared last, so that it is stopped and joined before the buffer goes away
+    std::jthread writer;
+
+    Logger();
+    // a message longer than a slot is cut and ends with CUT_MARK
+    void push(LogLevel messageLevel, char *text, std::size_t length);
+    [[nodiscard]] bool hasPending() const;
+    // writes out every message published so far, returns how many there were
+    std::size_t drain();
+    void writeLoop(std::stop_token stopToken);
+
+    static void append(char *&out, const char *end, std::string_view text);
+    static void append(char *&out, const char *end, char character);
+    template <std::integral T>
+    static void append(char *&out, const char *end, T number);
+};
+
+template <LogLevel messageLevel, typename... Args>
+void Logger::log(const Args &...args) {
+    if constexpr (messageLevel >= MIN_COMPILED_LOG_LEVEL) {
+        if (messageLevel < level.load(std::memory_order_relaxed)) {
+            return;
+        }
+        // a byte more than a slot holds, so that push() sees a message that does not fit
+        char text[TEXT_SIZE + 1];
+        char *out = text;
+        (append(out, text + sizeof(text), args), ...);
+        push(messageLevel, text, out - text);
+    }
+}
+
+template <std::integral T>
+void Logger::append(char *&out, const char *end, T number) {
+    // through a buffer of its own, so that a number that does not fit is cut like the text around it
+    char digits[std::numeric_limits<T>::digits10 + 3];
+    auto result = std::to_chars(digits, digits + sizeof(digits), number);
+    append(out, end, std::string_view(digits, result.ptr - digits));
+}
+
+template <typename... Args>
+void logDebug(const Args &...args) {
+    Logger::getInstance().log<DEBUG_LEVEL>(args...);
+}
+
+template <typename... Args>
+void logInfo(const Args &...args) {
+    Logger::getInstance().log<INFO_LEVEL>(args...);
+}
+
+template <typename... Args>
+void logWarning(const Args &...args) {
+    Logger::getInstance().log<WARNING_LEVEL>(args...);
+}
+
+template <typename... Args>
+void logError(const Args &...args) {
+    Logger::getInstance().log<ERROR_LEVEL>(args...);
+}
+
+#endif //OOP_LOGGER_H
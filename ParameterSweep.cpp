@@ -0,0 +1,168 @@
+#include "ParameterSweep.h"
+#include <algorithm>
+#include <climits>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include "Simulation.h"
+#include "ConfigParsing.h"
+#include "Exceptions.h"
+#include "Logger.h"
+#include "Utils.h"
+
+namespace {
+    using Setter = std::function<void(SweepRun &, unsigned long long)>;
+
+    std::string speciesParameter(const SpeciesRegistry &species, IndividualType type) {
+        return toColumnName(species[type].name);
+    }
+
+    std::vector<std::pair<std::string, Setter>> makeParameters(const SpeciesRegistry &species) {
+        std::vector<std::pair<std::string, Setter>> parameters;
+        for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species.end(); type = (IndividualType)(type + 1)) {
+            parameters.emplace_back(speciesParameter(species, type), [type](SweepRun &run, unsigned long long value) { run.config.generation[type] = (int) value; });
+        }
+        parameters.emplace_back("food", [](SweepRun &run, unsigned long long value) { run.config.quantityOfFood = (int) value; });
+        parameters.emplace_back("epoch_length", [](SweepRun &run, unsigned long long value) { run.config.epochLength = (int) value; });
+        parameters.emplace_back("epochs", [](SweepRun &run, unsigned long long value) { run.epochs = (int) value; });
+        parameters.emplace_back("seed", [](SweepRun &run, unsigned long long value) { run.config.seed = value; });
+        parameters.emplace_back("width", [](SweepRun &run, unsigned long long value) { run.config.width = (int) value; });
+        parameters.emplace_back("height", [](SweepRun &run, unsigned long long value) { run.config.height = (int) value; });
+        return parameters;
+    }
+
+    // every epoch of one run, as CSV rows
+    std::string runOne(const SweepRun &run) {
+        const SpeciesRegistry &species = *run.config.species;
+        const FightingRules &fighting = *run.config.fighting;
+        std::ostringstream rows;
+        int completedEpochs = 0;
+        try {
+            Simulation simulation(run.config);
+            for (int epoch = 0; epoch < run.epochs; ++epoch) {
+                EpochStatistics statistics = simulation.runEpoch();
+                rows << run.index << "," << simulation.getSeed() << "," << run.config.width << "," << run.config.height << ","
+                     << run.config.epochLength << "," << run.config.quantityOfFood;
+                for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species.end(); type = (IndividualType)(type + 1)) {
+                    rows << "," << countOf(run.config.generation, type);
+                }
+                rows << "," << statistics.epoch;
+                for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species.end(); type = (IndividualType)(type + 1)) {
+                    rows << "," << countOf(statistics.generation, type) << "," << countOf(statistics.survivors, type);
+                }
+                for (auto type = (FightingStrategyType)(FIGHTING_TYPE_BEGIN + 1); type != fighting.end(); type = (FightingStrategyType)(type + 1)) {
+                    rows << "," << countOf(statistics.fightingStrategySurvivors, type);
+                }
+                rows << "," << statistics.killedIndividuals << "," << statistics.matingsOccurred << "," << statistics.getTotalSurvivalRate() << "\n";
+                completedEpochs++;
+                try {
+                    simulation.spawnNextGeneration();
+                } catch (const NoSurvivorsException &e) {
+                    logInfo("Run ", run.index, ": ", e.what());
+                    break;
+                }
+            }
+        } catch (const InvalidWorldSizeException &e) {
+            logError("Run ", run.index, " skipped: ", e.what());
+        } catch (const std::exception &e) {
+            // whatever else goes wrong stays with this run, the others of the grid carry on
+            logError("Run ", run.index, " failed after ", completedEpochs, " epochs, its later rows are missing: ", e.what());
+        }
+        return rows.str();
+    }
+}
+
+ParameterSweep::ParameterSweep(std::istream &grid, std::shared_ptr<const SpeciesRegistry> species, const std::shared_ptr<const FightingRules> &fighting)
+        : species(std::move(species)), fighting(fighting) {
+    auto parameters = makeParameters(*this->species);
+    std::vector<std::string> given;
+    runs.emplace_back();
+    runs.back().config.species = this->species;
+    runs.back().config.fighting = fighting;
+    std::string line;
+    for (int lineNumber = 1; std::getline(grid, line); ++lineNumber) {
+        line = stripComment(line);
+        if (line.empty()) {
+            continue;
+        }
+        auto assignment = splitAssignment(line);
+        if (!assignment) {
+            throw InvalidSweepException(lineNumber, "expected name = value value ...");
+        }
+        const auto &[name, text] = *assignment;
+        auto parameter = std::find_if(parameters.begin(), parameters.end(), [&](const auto &p) { return p.first == name; });
+        if (parameter == parameters.end()) {
+            throw InvalidSweepException(lineNumber, "unknown parameter " + name);
+        }
+        // a species of the species file may be named like one of the other parameters
+        if (std::count_if(parameters.begin(), parameters.end(), [&](const auto &p) { return p.first == name; }) > 1) {
+            throw InvalidSweepException(lineNumber, name + " names both a species and a parameter");
+        }
+        if (std::find(given.begin(), given.end(), name) != given.end()) {
+            throw InvalidSweepException(lineNumber, name + " is given twice");
+        }
+        given.push_back(name);
+
+        auto values = parseNumbers<InvalidSweepException>(lineNumber, name, text, name == "seed" ? ULLONG_MAX : INT_MAX);
+        if (values.empty()) {
+            throw InvalidSweepException(lineNumber, "no values for " + name);
+        }
+
+        std::vector<SweepRun> combined;
+        combined.reserve(runs.size() * values.size());
+        for (const SweepRun &run : runs) {
+            for (unsigned long long value : values) {
+                combined.push_back(run);
+                parameter->second(combined.back(), value);
+            }
+        }
+        runs = std::move(combined);
+    }
+    for (std::size_t i = 0; i < runs.size(); ++i) {
+        runs[i].index = (int) i;
+        // the runs themselves are spread over the threads
+        runs[i].config.threads = 1;
+    }
+}
+
+const std::vector<SweepRun> &ParameterSweep::getRuns() const {
+    return runs;
+}
+
+void ParameterSweep::writeHeader(std::ostream &output) const {
+    output << "run,seed,width,height,epoch_length,food";
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species->end(); type = (IndividualType)(type + 1)) {
+        output << "," << speciesParameter(*species, type);
+    }
+    output << ",epoch";
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species->end(); type = (IndividualType)(type + 1)) {
+        output << "," << speciesParameter(*species, type) << "_spawned," << speciesParameter(*species, type) << "_survived";
+    }
+    for (auto type = (FightingStrategyType)(FIGHTING_TYPE_BEGIN + 1); type != fighting->end(); type = (FightingStrategyType)(type + 1)) {
+        output << "," << toColumnName((*fighting)[type].name) << "_survived";
+    }
+    output << ",killed,matings,survival_rate\n";
+}
+
+void ParameterSweep::run(WorkStealingPool &pool, std::ostream &output) const {
+    std::vector<std::string> rows(runs.size());
+    std::vector<bool> isFinished(runs.size(), false);
+    std::size_t nextToWrite = 0;
+    std::mutex mutex;
+    pool.run((int) runs.size(), [&](int i) {
+        std::string result = runOne(runs[i]);
+        std::lock_guard lock(mutex);
+        rows[i] = std::move(result);
+        isFinished[i] = true;
+        // hand out every run that is next in line, the later ones wait for it
+        while (nextToWrite < runs.size() && isFinished[nextToWrite]) {
+            output << rows[nextToWrite];
+            std::string().swap(rows[nextToWrite]);
+            nextToWrite++;
+        }
+    });
+    output.flush();
+}
@@ -0,0 +1,43 @@
+#ifndef OOP_PARAMETERSWEEP_H
+#define OOP_PARAMETERSWEEP_H
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <vector>
+#include "SimulationConfig.h"
+#include "WorkStealingPool.h"
+
+// one simulation of a sweep
+struct SweepRun {
+    int index = 0;
+    SimulationConfig config;
+    int epochs = 1;
+};
+
+// a grid of configurations run side by side, to see which starting mix does best
+// the grid lists one parameter per line as "name = value value ...", '#' starts a comment;
+// every combination of the listed values is a run, the last parameter changing fastest, and parameters left out keep their defaults
+// parameters: the name of every species in lower case (keystone, clairvoyant, redbull, ascendant, suitor and those of the species file),
+// food, epoch_length, epochs, seed, width, height
+class ParameterSweep {
+public:
+    // throws InvalidSweepException for an unknown parameter or a value that is not a number; every run fights by the same rules
+    explicit ParameterSweep(std::istream &grid, std::shared_ptr<const SpeciesRegistry> species = SpeciesRegistry::builtIn(),
+                            const std::shared_ptr<const FightingRules> &fighting = FightingRules::builtIn());
+
+    [[nodiscard]] const std::vector<SweepRun> &getRuns() const;
+    // runs every configuration as a task of the pool, each simulation on a single thread, and writes one CSV row per run and epoch
+    // the rows come out in the order of the runs, whatever order they finish in; a run that fails is logged and keeps
+    // the rows of the epochs it finished, without stopping the others
+    void run(WorkStealingPool &pool, std::ostream &output) const;
+    // the parameters of the run, then the spawned and surviving individuals of every species and the survivors of every strategy
+    void writeHeader(std::ostream &output) const;
+
+private:
+    std::shared_ptr<const SpeciesRegistry> species;
+    std::shared_ptr<const FightingRules> fighting;
+    std::vector<SweepRun> runs;
+};
+
+#endif //OOP_PARAMETERSWEEP_H
@@ -0,0 +1,75 @@
+#include "PhaseTimers.h"
+#include <algorithm>
+#include <cmath>
+
+PhaseTimers::Scope::Scope(PhaseTimers *timers, TickPhase phase) : timers(timers), phase(phase) {
+    if (timers) {
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+PhaseTimers::Scope::~Scope() {
+    if (timers) {
+        timers->record(phase, std::chrono::steady_clock::now() - start);
+    }
+}
+
+void PhaseTimers::record(TickPhase phase, std::chrono::nanoseconds duration) {
+    durations[phase][counts[phase] % WINDOW] = std::chrono::duration<float, std::micro>(duration).count();
+    counts[phase]++;
+}
+
+PhaseStatistics PhaseTimers::summarize(TickPhase phase) const {
+    PhaseStatistics statistics;
+    statistics.samples = (int) std::min<long long>(counts[phase], WINDOW);
+    if (statistics.samples == 0) {
+        return statistics;
+    }
+    std::array<float, WINDOW> sorted{};
+    std::copy_n(durations[phase].begin(), statistics.samples, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + statistics.samples);
+    // nearest rank
+    auto percentile = [&](double p) {
+        int rank = (int) std::ceil(p * statistics.samples) - 1;
+        return (double) sorted[std::clamp(rank, 0, statistics.samples - 1)];
+    };
+    statistics.p50 = percentile(0.50);
+    statistics.p95 = percentile(0.95);
+    statistics.p99 = percentile(0.99);
+    return statistics;
+}
+
+void PhaseTimers::summarize(std::array<PhaseStatistics, TICK_PHASE_END> &statistics) const {
+    for (auto phase = (TickPhase)(TICK_PHASE_BEGIN + 1); phase != TICK_PHASE_END; phase = (TickPhase)(phase + 1)) {
+        statistics[phase] = summarize(phase);
+    }
+}
+
+void PhaseTimers::writeCsvHeader(std::ostream &os) {
+    os << "epoch,phase,samples,p50_us,p95_us,p99_us\n";
+}
+
+void PhaseTimers::writeCsv(std::ostream &os, int epoch) const {
+    for (auto phase = (TickPhase)(TICK_PHASE_BEGIN + 1); phase != TICK_PHASE_END; phase = (TickPhase)(phase + 1)) {
+        PhaseStatistics statistics = summarize(phase);
+        if (statistics.samples > 0) {
+            os << epoch << "," << tickPhaseToString(phase) << "," << statistics.samples << "," << statistics.p50 << ","
+               << statistics.p95 << "," << statistics.p99 << "\n";
+        }
+    }
+}
+
+void PhaseTimers::writeJson(std::ostream &os, int epoch) const {
+    os << "{\"epoch\": " << epoch << ", \"phases\": {";
+    bool isFirst = true;
+    for (auto phase = (TickPhase)(TICK_PHASE_BEGIN + 1); phase != TICK_PHASE_END; phase = (TickPhase)(phase + 1)) {
+        PhaseStatistics statistics = summarize(phase);
+        if (statistics.samples == 0) {
+            continue;
+        }
+        os << (isFirst ? "" : ", ") << "\"" << tickPhaseToString(phase) << "\": {\"samples\": " << statistics.samples
+           << ", \"p50_us\": " << statistics.p50 << ", \"p95_us\": " << statistics.p95 << ", \"p99_us\": " << statistics.p99 << "}";
+        isFirst = false;
+    }
+    os << "}}\n";
+}
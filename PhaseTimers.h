@@ -0,0 +1,61 @@
+#ifndef OOP_PHASETIMERS_H
+#define OOP_PHASETIMERS_H
+
+#include <array>
+#include <chrono>
+#include <ostream>
+#include "TickPhase.h"
+
+// percentiles of the latest durations of one phase, in microseconds
+struct PhaseStatistics {
+    int samples = 0;
+    double p50 = 0;
+    double p95 = 0;
+    double p99 = 0;
+};
+
+// rolling durations of the phases of a tick
+// recording a duration only stores it in a fixed window, the percentiles are worked out when somebody asks for them,
+// so that timing a tick costs two clock reads per phase
+class PhaseTimers {
+public:
+    // durations kept per phase, older ones are overwritten
+    const static int WINDOW = 256;
+
+    // times a phase from its construction to its destruction, does nothing for disabled timers
+    class Scope {
+    public:
+        Scope(PhaseTimers *timers, TickPhase phase);
+        Scope(const Scope &other) = delete;
+        Scope& operator=(const Scope &other) = delete;
+        ~Scope();
+
+    private:
+        PhaseTimers *timers;
+        TickPhase phase;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    explicit PhaseTimers(bool enabled = true) : enabled(enabled) {}
+
+    [[nodiscard]] Scope time(TickPhase phase) { return {enabled ? this : nullptr, phase}; }
+    void record(TickPhase phase, std::chrono::nanoseconds duration);
+    [[nodiscard]] bool isEnabled() const { return enabled; }
+
+    [[nodiscard]] PhaseStatistics summarize(TickPhase phase) const;
+    void summarize(std::array<PhaseStatistics, TICK_PHASE_END> &statistics) const;
+
+    static void writeCsvHeader(std::ostream &os);
+    // one line per phase that has been timed
+    void writeCsv(std::ostream &os, int epoch) const;
+    // one JSON object on a single line, so that a file of epochs can be read line by line
+    void writeJson(std::ostream &os, int epoch) const;
+
+private:
+    bool enabled;
+    std::array<std::array<float, WINDOW>, TICK_PHASE_END> durations{};
+    // durations recorded so far for every phase, the next one goes to count % WINDOW
+    std::array<long long, TICK_PHASE_END> counts{};
+};
+
+#endif //OOP_PHASETIMERS_H
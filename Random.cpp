@@ -0,0 +1,122 @@
+#include "Random.h"
+#include <atomic>
+#include <mutex>
+#include <random>
+
+namespace {
+    std::uint64_t splitMix64(std::uint64_t &x) {
+        std::uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    std::uint64_t rotateLeft(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    std::atomic<std::uint64_t> globalSeed{0};
+    // bumped on every setRandomSeed, so that threads know their stream has to be reseeded
+    std::atomic<std::uint64_t> seedVersion{0};
+    std::atomic<std::uint64_t> nextThreadStream{0};
+    std::once_flag defaultSeedFlag;
+
+    struct ThreadRandom {
+        RandomEngine engine;
+        std::uint64_t version = 0;
+        std::uint64_t stream = nextThreadStream++;
+        RandomEngine *current = nullptr;
+    };
+
+    thread_local ThreadRandom threadRandom;
+
+    void ensureSeeded() {
+        std::call_once(defaultSeedFlag, [] {
+            if (seedVersion == 0) {
+                setRandomSeed(generateRandomSeed());
+            }
+        });
+    }
+}
+
+RandomEngine::RandomEngine(std::uint64_t seed, std::uint64_t stream) {
+    std::uint64_t x = seed ^ rotateLeft(stream * 0xD1B54A32D192ED03ULL, 17);
+    for (auto &word : state) {
+        word = splitMix64(x);
+    }
+}
+
+RandomEngine::result_type RandomEngine::operator()() {
+    const std::uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+    const std::uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotateLeft(state[3], 45);
+    return result;
+}
+
+int RandomEngine::nextInt(int mn, int mx) {
+    // Lemire's nearly divisionless method, with rejection so that the result is exactly uniform
+    auto range = (std::uint64_t) ((std::int64_t) mx - mn) + 1;
+    auto r32 = (std::uint32_t) range;
+    std::uint64_t product = ((*this)() >> 32) * r32;
+    if ((std::uint32_t) product < r32) {
+        std::uint32_t threshold = (0u - r32) % r32;
+        while ((std::uint32_t) product < threshold) {
+            product = ((*this)() >> 32) * r32;
+        }
+    }
+    return (int) ((std::int64_t) mn + (std::int64_t) (product >> 32));
+}
+
+void RandomEngine::fill(std::span<std::uint64_t> buffer) {
+    for (auto &word : buffer) {
+        word = (*this)();
+    }
+}
+
+std::uint32_t RandomEngine::bounded(std::uint64_t bits, std::uint32_t range) {
+    return (std::uint32_t) (((bits >> 32) * range) >> 32);
+}
+
+RandomEngineScope::RandomEngineScope(RandomEngine &engine) : previous(threadRandom.current) {
+    threadRandom.current = &engine;
+}
+
+RandomEngineScope::~RandomEngineScope() {
+    threadRandom.current = previous;
+}
+
+void setRandomSeed(std::uint64_t seed) {
+    globalSeed = seed;
+    seedVersion++;
+}
+
+std::uint64_t getRandomSeed() {
+    ensureSeeded();
+    return globalSeed;
+}
+
+std::uint64_t generateRandomSeed() {
+    std::random_device rd;
+    return ((std::uint64_t) rd() << 32) | rd();
+}
+
+RandomEngine &currentRandomEngine() {
+    if (threadRandom.current != nullptr) {
+        return *threadRandom.current;
+    }
+    ensureSeeded();
+    if (threadRandom.version != seedVersion) {
+        threadRandom.engine = RandomEngine(globalSeed, threadRandom.stream);
+        threadRandom.version = seedVersion;
+    }
+    return threadRandom.engine;
+}
+
+int randomIntegerFromInterval(int mn, int mx) {
+    return currentRandomEngine().nextInt(mn, mx);
+}
@@ -0,0 +1,55 @@
+#ifndef OOP_RANDOM_H
+#define OOP_RANDOM_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+// xoshiro256** generator: 32 bytes of state, a few instructions per number
+// independent streams are obtained by seeding with the same seed and a different stream number
+class RandomEngine {
+public:
+    using result_type = std::uint64_t;
+
+    explicit RandomEngine(std::uint64_t seed = 0, std::uint64_t stream = 0);
+    result_type operator()();
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // uniformly distributed integer in [mn, mx]
+    int nextInt(int mn, int mx);
+    // fills the whole buffer with random bits in one go
+    void fill(std::span<std::uint64_t> buffer);
+    // maps random bits to [0, range); the bias is below range / 2^32, fine for the board sizes we use
+    static std::uint32_t bounded(std::uint64_t bits, std::uint32_t range);
+    // the whole state, so that a saved simulation draws the same numbers once it is loaded again
+    [[nodiscard]] const std::array<std::uint64_t, 4> &getState() const { return state; }
+    void setState(const std::array<std::uint64_t, 4> &newState) { state = newState; }
+
+private:
+    std::array<std::uint64_t, 4> state{};
+};
+
+// makes an engine the one used by randomIntegerFromInterval on the current thread, until the scope ends
+class RandomEngineScope {
+public:
+    explicit RandomEngineScope(RandomEngine &engine);
+    RandomEngineScope(const RandomEngineScope &other) = delete;
+    RandomEngineScope& operator=(const RandomEngineScope &other) = delete;
+    ~RandomEngineScope();
+
+private:
+    RandomEngine *previous;
+};
+
+// seed of the per-thread streams used outside of any RandomEngineScope
+// each thread gets its own stream of this seed; if never set, the seed comes from std::random_device
+void setRandomSeed(std::uint64_t seed);
+std::uint64_t getRandomSeed();
+std::uint64_t generateRandomSeed();
+RandomEngine &currentRandomEngine();
+
+int randomIntegerFromInterval(int mn, int mx);
+
+#endif //OOP_RANDOM_H
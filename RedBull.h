@@ -5,10 +5,9 @@
 
 class RedBull : public Individual {
 public:
-    RedBull(int x, int y);
-    [[nodiscard]] sf::Color getOwnColor() const override;
-    [[nodiscard]] int getHunger() const override;
-    [[nodiscard]] int getSpeed() const override;
+    const static IndividualType TYPE = REDBULL_TYPE;
+
+    RedBull(EntityStore &store, EntityStore::Id id);
 };
 
 
@@ -0,0 +1,29 @@
+#include "RowBitmap.h"
+
+void RowBitmap::reset(int newWidth, int newHeight) {
+    if (newWidth == width && newHeight == height) {
+        clear();
+        return;
+    }
+    width = newWidth;
+    height = newHeight;
+    wordsPerRow = (width + 63) / 64;
+    rowStride = wordsPerRow + 2;
+    bits.assign((std::size_t) rowStride * height, 0);
+    for (int y = 0; y < height; ++y) {
+        bits[index(y, -1)] = edge;
+        bits[index(y, wordsPerRow)] = edge;
+    }
+    usedWords.clear();
+}
+
+void RowBitmap::clear() {
+    for (int word : usedWords) {
+        bits[word] = 0;
+    }
+    usedWords.clear();
+}
+
+std::size_t RowBitmap::getMemoryUsage() const {
+    return bits.capacity() * sizeof(std::uint64_t) + usedWords.capacity() * sizeof(int);
+}
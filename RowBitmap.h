@@ -0,0 +1,234 @@
+#ifndef OOP_ROWBITMAP_H
+#define OOP_ROWBITMAP_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+struct NearestFirstOffset {
+    std::int8_t dx, dy;
+};
+
+// the offsets of the square of the given radius ordered by their distance from its center, then in reading order,
+// so that the first accepted cell met along them is the closest one, built when compiling
+template <int RADIUS>
+constexpr std::array<NearestFirstOffset, (2 * RADIUS + 1) * (2 * RADIUS + 1)> makeNearestFirstOffsets() {
+    static_assert(RADIUS <= INT8_MAX);
+    std::array<NearestFirstOffset, (2 * RADIUS + 1) * (2 * RADIUS + 1)> offsets{};
+    std::size_t i = 0;
+    for (int dy = -RADIUS; dy <= RADIUS; ++dy) {
+        for (int dx = -RADIUS; dx <= RADIUS; ++dx) {
+            offsets[i++] = {(std::int8_t) dx, (std::int8_t) dy};
+        }
+    }
+    std::sort(offsets.begin(), offsets.end(), [](NearestFirstOffset a, NearestFirstOffset b) {
+        int distanceA = a.dx * a.dx + a.dy * a.dy;
+        int distanceB = b.dx * b.dx + b.dy * b.dy;
+        if (distanceA != distanceB) {
+            return distanceA < distanceB;
+        }
+        return a.dy != b.dy ? a.dy < b.dy : a.dx < b.dx;
+    });
+    return offsets;
+}
+
+// one bit per cell of the world, 64 cells of a row packed to a word
+// every row has an extra word on either side holding the edge value, so that 64 consecutive cells can be read as a single word
+// even where they run off the board; only the words set since the last clear are cleared again, so clearing costs
+// the cells that were set, not the size of the world
+class RowBitmap {
+public:
+    // whether the cells off the board read as set
+    explicit RowBitmap(bool isEdgeSet) : edge(isEdgeSet ? ~std::uint64_t{0} : 0) {}
+
+    // a world of the given size without any bit set, keeping the memory when the size does not change
+    void reset(int width, int height);
+    void set(int pos);
+    // unsets every bit set since the last clear
+    void clear();
+    // the 64 cells of row y starting at column x0, x0 from -64 to width - 1; bit i is column x0 + i
+    [[nodiscard]] std::uint64_t window(int y, int x0) const;
+    // the cell closest to (x, y) inside the square of the given radius whose bit is isSet and that satisfies accept,
+    // closeness being the euclidean distance and ties going to reading order; std::nullopt if there is none;
+    // the radii the species and the placement of individuals use walk a nearest-first table up to the first accepted cell,
+    // the others are searched by rows
+    template <typename Predicate>
+    std::optional<int> findNearest(int x, int y, int radius, bool isSet, Predicate &&accept) const;
+    // the same cell, read a row at a time from y outwards until the rows are further than the best cell found;
+    // faster than the table where few cells are isSet, as the table is walked to its end whenever the square holds none
+    template <typename Predicate>
+    std::optional<int> findNearestByRows(int x, int y, int radius, bool isSet, Predicate &&accept) const;
+    // word w of row y, -1 and getWordsPerRow() being the edge words
+    [[nodiscard]] std::uint64_t word(int y, int w) const { return bits[index(y, w)]; }
+    [[nodiscard]] int getWidth() const { return width; }
+    [[nodiscard]] int getHeight() const { return height; }
+    [[nodiscard]] int getWordsPerRow() const { return wordsPerRow; }
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+
+private:
+    std::uint64_t edge;
+    int width = 0;
+    int height = 0;
+    int wordsPerRow = 0;
+    // words of a row, the edge words included
+    int rowStride = 0;
+    std::vector<std::uint64_t> bits;
+    std::vector<int> usedWords;
+
+    // a square up to this radius is read one window per row, with the center column at this bit
+    const static int WINDOW_CENTER = 31;
+
+    // vision 2 of most species, 5 of the Clairvoyant's and of a displaced individual, 10 of a fed Ascendant's
+    // and 15 of the offspring around their parent
+    constexpr static auto NEAREST_FIRST_2 = makeNearestFirstOffsets<2>();
+    constexpr static auto NEAREST_FIRST_5 = makeNearestFirstOffsets<5>();
+    constexpr static auto NEAREST_FIRST_10 = makeNearestFirstOffsets<10>();
+    constexpr static auto NEAREST_FIRST_15 = makeNearestFirstOffsets<15>();
+
+    [[nodiscard]] std::size_t index(int y, int w) const { return (std::size_t) y * rowStride + w + 1; }
+    template <std::size_t N, typename Predicate>
+    std::optional<int> walkNearestFirst(const std::array<NearestFirstOffset, N> &offsets, int x, int y, bool isSet, Predicate &&accept) const;
+    // the searches past WINDOW_CENTER, a word at a time
+    template <typename Predicate>
+    std::optional<int> findNearestInRows(int x, int y, int radius, bool isSet, Predicate &&accept) const;
+};
+
+template <typename Predicate>
+std::optional<int> RowBitmap::findNearest(int x, int y, int radius, bool isSet, Predicate &&accept) const {
+    switch (radius) {
+        case 2:
+            return walkNearestFirst(NEAREST_FIRST_2, x, y, isSet, accept);
+        case 5:
+            return walkNearestFirst(NEAREST_FIRST_5, x, y, isSet, accept);
+        case 10:
+            return walkNearestFirst(NEAREST_FIRST_10, x, y, isSet, accept);
+        case 15:
+            return walkNearestFirst(NEAREST_FIRST_15, x, y, isSet, accept);
+        default:
+            return findNearestByRows(x, y, radius, isSet, accept);
+    }
+}
+
+template <std::size_t N, typename Predicate>
+std::optional<int> RowBitmap::walkNearestFirst(const std::array<NearestFirstOffset, N> &offsets, int x, int y, bool isSet, Predicate &&accept) const {
+    for (NearestFirstOffset offset : offsets) {
+        int j = y + offset.dy;
+        int k = x + offset.dx;
+        if (j < 0 || j >= height || k < 0 || k >= width) {
+            continue;
+        }
+        bool isCellSet = (bits[index(j, k / 64)] >> (k % 64)) & 1;
+        if (isCellSet == isSet && accept(j * width + k)) {
+            return j * width + k;
+        }
+    }
+    return std::nullopt;
+}
+
+template <typename Predicate>
+std::optional<int> RowBitmap::findNearestByRows(int x, int y, int radius, bool isSet, Predicate &&accept) const {
+    if (radius > WINDOW_CENTER) {
+        return findNearestInRows(x, y, radius, isSet, accept);
+    }
+    // bit WINDOW_CENTER + dx of a window stands for column x + dx
+    std::uint64_t inSquare = (~std::uint64_t{0} >> (63 - 2 * radius)) << (WINDOW_CENTER - radius);
+    int best = -1;
+    int bestDistance = INT_MAX;
+    // the closest cell of row j on either side of x, the next one if it is not accepted
+    auto searchRow = [&](int j, int dy) {
+        std::uint64_t row = window(j, x - WINDOW_CENTER);
+        std::uint64_t cells = (isSet ? row : ~row) & inSquare;
+        while (cells != 0) {
+            int right = std::countr_zero(cells >> WINDOW_CENTER);
+            int left = std::countl_zero(cells << (63 - WINDOW_CENTER));
+            int dx = left <= right ? -left : right;
+            int distance = dx * dx + dy * dy;
+            int pos = j * width + x + dx;
+            if (distance > bestDistance || (distance == bestDistance && pos > best)) {
+                return;
+            }
+            if (accept(pos)) {
+                best = pos;
+                bestDistance = distance;
+                return;
+            }
+            cells &= ~(std::uint64_t{1} << (WINDOW_CENTER + dx));
+        }
+    };
+    // rows by their distance from y, until they are further than the best cell found
+    for (int dy = 0; dy <= radius && dy * dy <= bestDistance; ++dy) {
+        if (y - dy >= 0) {
+            searchRow(y - dy, dy);
+        }
+        if (dy > 0 && y + dy < height) {
+            searchRow(y + dy, dy);
+        }
+    }
+    return best < 0 ? std::nullopt : std::optional<int>(best);
+}
+
+template <typename Predicate>
+std::optional<int> RowBitmap::findNearestInRows(int x, int y, int radius, bool isSet, Predicate &&accept) const {
+    // nothing is further than the world is wide or high, a larger radius would only add empty rows and overflow
+    radius = std::min(radius, std::max(width, height));
+    std::optional<int> best;
+    long long bestDistance = LLONG_MAX;
+    int x0 = std::max(x - radius, 0);
+    int x1 = std::min(x + radius, width - 1);
+    // a row dy away holds nothing closer than dy, the rows past the best distance are left out
+    for (int dy = 0; dy <= radius && (long long) dy * dy <= bestDistance; ++dy) {
+        // row y is searched once, on the first side
+        for (int side = 0; side < (dy == 0 ? 1 : 2); ++side) {
+            int j = side == 0 ? y - dy : y + dy;
+            if (j < 0 || j >= height) {
+                continue;
+            }
+            for (int w = x0 / 64; w <= x1 / 64; ++w) {
+                std::uint64_t cells = isSet ? word(j, w) : ~word(j, w);
+                if (w == x0 / 64) {
+                    cells &= ~std::uint64_t{0} << (x0 % 64);
+                }
+                if (w == x1 / 64) {
+                    cells &= ~std::uint64_t{0} >> (63 - x1 % 64);
+                }
+                for (; cells != 0; cells &= cells - 1) {
+                    int column = w * 64 + std::countr_zero(cells);
+                    long long distance = (long long) (column - x) * (column - x) + (long long) dy * dy;
+                    int pos = j * width + column;
+                    if ((distance < bestDistance || (distance == bestDistance && pos < *best)) && accept(pos)) {
+                        best = pos;
+                        bestDistance = distance;
+                    }
+                }
+            }
+        }
+    }
+    return best;
+}
+
+inline void RowBitmap::set(int pos) {
+    int x = pos % width;
+    auto word = (int) index(pos / width, x / 64);
+    if (bits[word] == 0) {
+        usedWords.push_back(word);
+    }
+    bits[word] |= std::uint64_t{1} << (x % 64);
+}
+
+inline std::uint64_t RowBitmap::window(int y, int x0) const {
+    int shifted = x0 + 64;
+    std::size_t first = index(y, shifted / 64 - 1);
+    int shift = shifted % 64;
+    // shifting the second word twice keeps a shift of 0 defined
+    std::uint64_t value = (bits[first] >> shift) | ((bits[first + 1] << 1) << (63 - shift));
+    // the unused bits at the end of the last word are not cells, they read as the edge too
+    int columns = std::min(width - x0, 64);
+    std::uint64_t onBoard = ~std::uint64_t{0} >> (64 - columns);
+    return (value & onBoard) | (edge & ~onBoard);
+}
+
+#endif //OOP_ROWBITMAP_H
@@ -0,0 +1,651 @@
+#include <algorithm>
+#include <climits>
+#include <thread>
+#include "Simulation.h"
+#include "Logger.h"
+#include "Food.h"
+#include "Individual.h"
+#include "Cell.h"
+#include "CellFactory.h"
+#include "IndividualType.h"
+#include "Exceptions.h"
+#include "Checkpoint.h"
+#include "Utils.h"
+
+
+bool Simulation::produceOffspring(int pos, IndividualType suitorSpecies, IndividualType target) {
+    auto freeSpot = findFreeSpot(pos, OFFSPRING_RADIUS);
+    if (!freeSpot) {
+        return false;
+    }
+    auto offspring = CellFactory::createSuitor(entities, *freeSpot % width, *freeSpot / width, target, suitorSpecies);
+
+    // Each baby starts off with 3 food points at birth.
+    for (int i = 0; i < 3; ++i) {
+        offspring->eat();
+    }
+
+    place(*freeSpot, offspring->getId());
+    return true;
+}
+
+void Simulation::mate(EntityStore::Id individual, EntityStore::Id suitor) {
+    // When a couple mates, they can either produce one, two or three babies - this number gets chosen randomly.
+    int offspringQuantity = randomIntegerFromInterval(1, 3);
+    for (int i = 0; i < offspringQuantity; ++i) {
+        // If there are no more empty spots on the board, the mating process stops.
+        int position = entities.individual(individual).getPosition();
+        if (!produceOffspring(position, entities.species(suitor), entities.mateTarget(suitor))) {
+            logWarning("Ran out of empty positions in radius ", OFFSPRING_RADIUS, " around (", position % width, ", ", position / width, ")");
+            break;
+        }
+        matingsOccurred++;
+    }
+    logDebug("Successful mating!");
+}
+
+Simulation::Simulation(const SimulationConfig &config) : species(config.species),
+                                                          fighting(config.fighting),
+                                                          seed(config.seed.value_or(generateRandomSeed())),
+                                                          random(seed),
+                                                          width(config.width),
+                                                          height(config.height),
+                                                          quantityOfFood(config.quantityOfFood),
+                                                          epochLength(config.epochLength),
+                                                          pool(poolSize(config.threads)),
+                                                          timers(config.timePhases) {
+    // positions are ints all over the simulation
+    if (width <= 0 || height <= 0 || (long long) width * height > INT_MAX) {
+        throw InvalidWorldSizeException(width, height);
+    }
+    entities.setWorldSize(width, height);
+    entities.setSpecies(*species);
+    entities.setFighting(*fighting);
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species->end(); type = (IndividualType)(type + 1)) {
+        currentGeneration[type] = countOf(config.generation, type);
+    }
+    // every individual and every piece of food needs a cell of its own
+    if ((long long) getTotalIndividuals() + quantityOfFood > (long long) width * height) {
+        throw InvalidWorldSizeException(width, height);
+    }
+    RandomEngineScope scope(random);
+    resetGeneration(currentGeneration);
+}
+
+Simulation::Simulation(std::istream &checkpoint, const SimulationConfig &config) : seed(0),
+                                                                                   width(0),
+                                                                                   height(0),
+                                                                                   quantityOfFood(0),
+                                                                                   epochLength(0),
+                                                                                   pool(poolSize(config.threads)),
+                                                                                   timers(config.timePhases) {
+    readCheckpoint(checkpoint);
+}
+
+int Simulation::poolSize(int threads) {
+    return threads > 0 ? threads : (int) std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+void Simulation::step() {
+    RandomEngineScope scope(random);
+    // only the occupied cells are visited, in reading order, however large and empty the world is
+    {
+        auto timer = timers.time(FOOD_SEARCH_PHASE);
+        std::sort(boardCells.begin(), boardCells.end());
+        foodIndex.rebuild(board, boardCells, width, height);
+    }
+    {
+        auto timer = timers.time(MOVEMENT_PHASE);
+        planMoves();
+    }
+    {
+        auto timer = timers.time(INTERACTION_PHASE);
+        // resolution runs in reading order, so whoever comes first keeps a contested cell or food, for any number of threads
+        for (int i : boardCells) {
+            EntityStore::Id id = board[i];
+            if (id != EntityStore::NONE) {
+                if (entities.isIndividual(id)) {
+                    resolveMove(id);
+                } else if (!entities.isIndividual(futureBoard[i])) {
+                    // the food stays in place, unless somebody stepped on it
+                    place(i, id);
+                }
+            }
+        }
+    }
+    {
+        auto timer = timers.time(ENCOUNTER_PHASE);
+        resolveEncounters();
+    }
+    {
+        auto timer = timers.time(SWAP_PHASE);
+        swapBoards();
+    }
+    tickCounter++;
+}
+
+void Simulation::planMoves() {
+    // each tile draws from its own stream of this tick, so the plan does not depend on which thread ran which tile
+    std::uint64_t tickSeed = random();
+    int tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    int tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+
+    // bucket the individuals by tile and species, keeping the reading order inside each bucket
+    int tiles = tilesX * tilesY;
+    int speciesCount = species->end();
+    tileStarts.assign(tiles * speciesCount + 1, 0);
+    for (int pos : boardCells) {
+        if (entities.isIndividual(board[pos])) {
+            tileStarts[bucketOf(pos, tilesX) + 1]++;
+        }
+    }
+    for (std::size_t bucket = 1; bucket < tileStarts.size(); ++bucket) {
+        tileStarts[bucket] += tileStarts[bucket - 1];
+    }
+    busyTiles.clear();
+    for (int tile = 0; tile < tiles; ++tile) {
+        if (tileStarts[(tile + 1) * speciesCount] != tileStarts[tile * speciesCount]) {
+            busyTiles.push_back(tile);
+        }
+    }
+    tileCells.resize(tileStarts.back());
+    std::vector<int> next(tileStarts.begin(), tileStarts.end() - 1);
+    for (int pos : boardCells) {
+        if (entities.isIndividual(board[pos])) {
+            tileCells[next[bucketOf(pos, tilesX)]++] = pos;
+        }
+    }
+
+    plannedFood.resize(entities.size());
+    pool.run((int) busyTiles.size(), [&](int task) {
+        int tile = busyTiles[task];
+        RandomEngine tileRandom(tickSeed, tile);
+        RandomEngineScope tileScope(tileRandom);
+        for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != speciesCount; type = (IndividualType)(type + 1)) {
+            int bucket = tile * speciesCount + type;
+            const Species &traits = (*species)[type];
+            for (int k = tileStarts[bucket]; k < tileStarts[bucket + 1]; ++k) {
+                planMove(board[tileCells[k]], traits);
+            }
+        }
+    });
+}
+
+int Simulation::bucketOf(int pos, int tilesX) const {
+    int tile = (pos / width / TILE_SIZE) * tilesX + pos % width / TILE_SIZE;
+    return tile * species->end() + entities.species(board[pos]);
+}
+
+void Simulation::planMove(EntityStore::Id id, const Species &traits) {
+    bool hasEaten = entities.hasEaten(id);
+    // claims are only settled during the resolution, so aim for the closest food whoever else wants it
+    auto food = foodIndex.find(entities.x(id), entities.y(id), traits.vision[hasEaten], [](int) {
+        return true;
+    });
+    plannedFood[id] = food.value_or(NO_FOOD);
+    if (!food) {
+        // move() keeps the individual on the board
+        entities.individual(id).move(traits.speed[hasEaten]);
+    }
+}
+
+void Simulation::resolveMove(EntityStore::Id id) {
+    if (plannedFood[id] != NO_FOOD) {
+        Individual &individual = entities.individual(id);
+        // somebody earlier in reading order may have taken the planned food, then the next closest one is the target
+        auto coords = isClaimable(plannedFood[id]) ? std::optional<int>(plannedFood[id]) : findFoodInRange(id, individual.getVision());
+        if (coords) {
+            place(*coords, id);
+            individual.setCoords(*coords % width, *coords / width);
+            individual.eat();
+            return;
+        }
+        // everything in sight has been taken
+        individual.move();
+    }
+    // the view is only needed for eating, the coordinates are in the store
+    int newPosition = entities.y(id) * width + entities.x(id);
+    if (entities.isIndividual(futureBoard[newPosition])) {
+        encounters.push_back(id);
+    } else {
+        place(newPosition, id);
+    }
+}
+
+void Simulation::resolveEncounters() {
+    for (EntityStore::Id id : encounters) {
+        // whoever holds the cell by now, an earlier encounter may have replaced the individual that was there
+        int position = entities.y(id) * width + entities.x(id);
+        try {
+            handleInteraction(id, futureBoard[position]);
+        } catch (const InvalidFightingOutcomeException& e) {
+            logError(e.what());
+        }
+    }
+    encounters.clear();
+}
+
+EpochStatistics Simulation::runEpoch() {
+    while (!isEpochOver()) {
+        step();
+    }
+    return endEpoch();
+}
+
+EpochStatistics Simulation::endEpoch() {
+    epochCounter++;
+    {
+        auto timer = timers.time(FITNESS_PHASE);
+        computeFitness();
+    }
+
+    EpochStatistics statistics;
+    statistics.species = species;
+    statistics.fighting = fighting;
+    statistics.epoch = epochCounter;
+    statistics.killedIndividuals = killedIndividuals;
+    statistics.matingsOccurred = matingsOccurred;
+    statistics.generation = currentGeneration;
+    statistics.survivors = survivorMap;
+    statistics.fightingStrategySurvivors = fightingStrategyMap;
+    return statistics;
+}
+
+void Simulation::spawnNextGeneration() {
+    RandomEngineScope scope(random);
+    resetGeneration(computeNewGeneration());
+}
+
+// Total number of survivors: p1 * x1 + p2 * x2 + ...
+// Total number of individuals: x1 + x2 + ...
+// Number of individuals of given species, proportional to their fitness: (p1 * x1 / (total number of survivors)) * (total number of individuals)
+std::unordered_map<IndividualType, int> Simulation::computeNewGeneration() {
+    std::unordered_map<IndividualType, int> newGeneration;
+    int totalIndividuals = getTotalIndividuals();
+    int totalSurvivors = getTotalSurvivors();
+    if (totalSurvivors == 0) {
+        throw NoSurvivorsException(epochCounter);
+    }
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species->end(); type = (IndividualType) (type + 1)) {
+        newGeneration[type] = currentGeneration[type] == 0 ? 0 : (int) ((1.0 * survivorMap[type] / currentGeneration[type]) * currentGeneration[type] * totalIndividuals) / totalSurvivors;
+    }
+    return newGeneration;
+}
+
+void Simulation::assertFitnessOfIndividual(EntityStore::Id id) {
+    const Individual &individual = entities.individual(id);
+    checkCoordinates(entities.x(id), entities.y(id), width, height);
+    if (!individual.checkIfAlive()) {
+        board.set(individual.getPosition(), EntityStore::NONE);
+    } else {
+        // species and fighting strategy are stored next to the rest of the state, no need to inspect the view
+        survivorMap[entities.species(id)] += 1;
+        fightingStrategyMap[entities.strategy(id)] += 1;
+    }
+}
+
+void Simulation::computeFitness() {
+    for (int pos : boardCells) {
+        EntityStore::Id id = board[pos];
+        if (entities.isIndividual(id)) {
+            try {
+                assertFitnessOfIndividual(id);
+            } catch (const InvalidIndividualPositionException &e) {
+                logError(e.what());
+            }
+        }
+    }
+}
+
+void Simulation::generateCells() {
+    entities.clear();
+    board.reset((std::size_t) width * height);
+    futureBoard.reset((std::size_t) width * height);
+    freeCells.reset(width, height);
+    boardCells.clear();
+    futureCells.clear();
+    int lowerBound = 0;
+
+    logInfo("Spawning ", getTotalIndividuals(), " individuals and ", quantityOfFood, " food");
+
+    auto randomPositions = generateRandomArray(getTotalIndividuals() + quantityOfFood, 0, width * height);
+
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species->end(); type = (IndividualType)(type + 1)) {
+        for (int i = lowerBound; i < lowerBound + currentGeneration[type]; i++) {
+            try {
+                board.set(randomPositions[i], CellFactory::createIndividual(entities, randomPositions[i] % width, randomPositions[i] / width, type)->getId());
+                boardCells.push_back(randomPositions[i]);
+            } catch (InvalidIndividualTypeException &e) {
+                logError(e.what());
+            }
+        }
+        lowerBound += currentGeneration[type];
+    }
+
+    for (int i = lowerBound; i < lowerBound + quantityOfFood; i++) {
+        board.set(randomPositions[i], EntityStore::FOOD);
+        boardCells.push_back(randomPositions[i]);
+    }
+
+}
+
+void Simulation::place(int pos, EntityStore::Id id) {
+    if (futureBoard[pos] == EntityStore::NONE) {
+        futureCells.push_back(pos);
+    }
+    futureBoard.set(pos, id);
+    freeCells.take(pos);
+}
+
+void Simulation::swapBoards() {
+    std::swap(board, futureBoard);
+    boardCells.swap(futureCells);
+    // the old board becomes the back buffer; only the cells it had written need to be emptied, which also frees its chunks
+    for (int pos : futureCells) {
+        futureBoard.set(pos, EntityStore::NONE);
+    }
+    futureCells.clear();
+    freeCells.clear();
+}
+
+std::optional<int> Simulation::findFreeSpot(int pos, int radius) {
+    return freeCells.findNearest(pos % width, pos / width, radius);
+}
+
+
+std::optional<int> Simulation::findFoodInRange(EntityStore::Id individual, int radius) {
+    return foodIndex.find(entities.x(individual), entities.y(individual), radius, [this](int pos) {
+        return isClaimable(pos);
+    });
+}
+
+bool Simulation::isClaimable(int foodPos) const {
+    // food claimed earlier in this tick is still on the board, but no longer up for grabs
+    return !entities.isIndividual(futureBoard[foodPos]);
+}
+
+int Simulation::getTotalIndividuals() const {
+    int totalIndividuals = 0;
+    for (auto individualType = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); individualType != species->end(); individualType = (IndividualType)(individualType + 1)) {
+        totalIndividuals += currentGeneration.at(individualType);
+    }
+    return totalIndividuals;
+}
+
+int Simulation::getTotalSurvivors() const {
+    int totalSurvivors = 0;
+    for (auto individualType = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); individualType != species->end(); individualType = (IndividualType)(individualType + 1)) {
+        totalSurvivors += countOf(survivorMap, individualType);
+    }
+    return totalSurvivors;
+}
+
+void Simulation::resetGeneration(std::unordered_map<IndividualType, int> generation) {
+    killedIndividuals = 0;
+    matingsOccurred = 0;
+    tickCounter = 0;
+    for (auto individualType = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); individualType != species->end(); individualType = (IndividualType)(individualType + 1)) {
+        currentGeneration[individualType] = generation[individualType];
+        survivorMap[individualType] = 0;
+    }
+    for (auto fightingStrategyType = (FightingStrategyType)(FIGHTING_TYPE_BEGIN + 1); fightingStrategyType != fighting->end(); fightingStrategyType = (FightingStrategyType)(fightingStrategyType + 1)) {
+        fightingStrategyMap[fightingStrategyType] = 0;
+    }
+    resetBoard();
+}
+
+void Simulation::resetBoard() {
+    generateCells();
+}
+
+
+bool Simulation::performSuitorCheck(EntityStore::Id individual, EntityStore::Id suitorCandidate) {
+    // a suitor only mates with the species it was born to court
+    if (!entities.traits(suitorCandidate).isSuitor() || entities.mateTarget(suitorCandidate) != entities.species(individual)) {
+        return false;
+    }
+    mate(individual, suitorCandidate);
+    return true;
+}
+
+void Simulation::handleInteraction(EntityStore::Id id1, EntityStore::Id id2) {
+    bool isLover1 = entities.strategy(id1) == LOVER_TYPE;
+    bool isLover2 = entities.strategy(id2) == LOVER_TYPE;
+    if (isLover1 && isLover2) {
+        handleFightingOutcome(id1, id2, LIVE_LIVE);
+    } else if (isLover1) {
+        performSuitorCheck(id2, id1);
+    } else if (isLover2) {
+        performSuitorCheck(id1, id2);
+    } else {
+        handleFightingOutcome(id1, id2, fighting->resolve(entities.strategy(id1), entities.strategy(id2)));
+    }
+}
+
+void Simulation::handleFightingOutcome(EntityStore::Id id1, EntityStore::Id id2, FightingOutcome fightingOutcome) {
+    int position = entities.individual(id1).getPosition();
+    switch (fightingOutcome) {
+        case LIVE_LIVE: {
+            if (auto freePosition = findFreeSpot(position, DISPLACEMENT_RADIUS)) {
+                place(*freePosition, id1);
+            } else {
+                logWarning("Ran out of empty positions in radius ", DISPLACEMENT_RADIUS, " around (", position % width, ", ", position / width, ")");
+            }
+            break;
+        }
+        case LIVE_DIE: {
+            logDebug("Individual killed.");
+            killedIndividuals++;
+            place(position, id1);
+            break;
+        }
+        case DIE_LIVE: {
+            logDebug("Individual killed.");
+            killedIndividuals++;
+            place(position, id2);
+            break;
+        }
+        default:
+            throw InvalidFightingOutcomeException();
+    }
+}
+
+bool Simulation::isEpochOver() const {
+    return tickCounter >= epochLength;
+}
+
+int Simulation::getEpoch() const {
+    return epochCounter;
+}
+
+int Simulation::getTick() const {
+    return tickCounter;
+}
+
+int Simulation::getWidth() const {
+    return width;
+}
+
+int Simulation::getHeight() const {
+    return height;
+}
+
+std::uint64_t Simulation::getSeed() const {
+    return seed;
+}
+
+const std::shared_ptr<const SpeciesRegistry> &Simulation::getSpecies() const {
+    return species;
+}
+
+const std::shared_ptr<const FightingRules> &Simulation::getFighting() const {
+    return fighting;
+}
+
+const ChunkedGrid<EntityStore::Id> &Simulation::getBoard() const {
+    return board;
+}
+
+std::size_t Simulation::getMemoryUsage() const {
+    std::size_t cellLists = (boardCells.capacity() + futureCells.capacity() + tileCells.capacity() + tileStarts.capacity()
+                             + busyTiles.capacity() + plannedFood.capacity()) * sizeof(int);
+    return board.getMemoryUsage() + futureBoard.getMemoryUsage() + foodIndex.getMemoryUsage() + freeCells.getMemoryUsage() + cellLists;
+}
+
+const EntityStore &Simulation::getEntities() const {
+    return entities;
+}
+
+const PhaseTimers &Simulation::getPhaseTimers() const {
+    return timers;
+}
+
+TickStatistics Simulation::getTickStatistics() const {
+    TickStatistics statistics;
+    statistics.epoch = epochCounter + 1;
+    statistics.tick = tickCounter;
+    statistics.killedIndividuals = killedIndividuals;
+    statistics.matingsOccurred = matingsOccurred;
+    statistics.occupiedCells = (int) boardCells.size();
+    return statistics;
+}
+
+void Simulation::takeSnapshot(BoardSnapshot &snapshot) const {
+    snapshot.width = width;
+    snapshot.height = height;
+    snapshot.epoch = epochCounter;
+    snapshot.tick = tickCounter;
+    timers.summarize(snapshot.phaseTimes);
+    snapshot.colors.assign((std::size_t) width * height, Color::Black);
+    for (int pos : boardCells) {
+        if (board[pos] != EntityStore::NONE) {
+            snapshot.colors[pos] = entities.cell(board[pos]).getColor();
+        }
+    }
+}
+
+namespace {
+    template <typename Type>
+    std::vector<int> countsOf(const std::unordered_map<Type, int> &map, Type begin, Type end) {
+        std::vector<int> counts;
+        for (auto type = (Type)(begin + 1); type != end; type = (Type)(type + 1)) {
+            counts.push_back(countOf(map, type));
+        }
+        return counts;
+    }
+
+    template <typename Type, typename Map>
+    void readCounts(CheckpointReader &reader, Map &map, Type begin, Type end) {
+        std::vector<int> counts;
+        reader.array(counts, end - begin - 1);
+        if (counts.size() != (std::size_t) (end - begin - 1)) {
+            throw InvalidCheckpointException("counters for " + std::to_string(counts.size()) + " types, " + std::to_string(end - begin - 1) + " expected");
+        }
+        map.clear();
+        for (auto type = (Type)(begin + 1); type != end; type = (Type)(type + 1)) {
+            map[type] = counts[type - begin - 1];
+        }
+    }
+}
+
+void Simulation::writeCheckpoint(std::ostream &os) const {
+    CheckpointWriter writer(os);
+    writer.value(Checkpoint::MAGIC);
+    writer.value(Checkpoint::VERSION);
+    writer.value(seed);
+    writer.value(random.getState());
+    species->writeCheckpoint(writer);
+    fighting->writeCheckpoint(writer);
+    for (int value : {width, height, quantityOfFood, epochLength, epochCounter, tickCounter, killedIndividuals, matingsOccurred}) {
+        writer.value(value);
+    }
+    writer.array(countsOf(currentGeneration, INDIVIDUAL_TYPE_BEGIN, species->end()));
+    writer.array(countsOf(survivorMap, INDIVIDUAL_TYPE_BEGIN, species->end()));
+    writer.array(countsOf(fightingStrategyMap, FIGHTING_TYPE_BEGIN, fighting->end()));
+    entities.writeCheckpoint(writer);
+    // between ticks the future board is empty, the current one is saved as its occupied cells in the order they are listed
+    std::vector<EntityStore::Id> ids;
+    ids.reserve(boardCells.size());
+    for (int pos : boardCells) {
+        ids.push_back(board[pos]);
+    }
+    writer.array(boardCells);
+    writer.array(ids);
+}
+
+void Simulation::readCheckpoint(std::istream &is) {
+    CheckpointReader reader(is);
+    if (reader.value<std::uint64_t>() != Checkpoint::MAGIC) {
+        throw InvalidCheckpointException("not a checkpoint");
+    }
+    if (auto version = reader.value<std::uint32_t>(); version != Checkpoint::VERSION) {
+        throw InvalidCheckpointException("format version " + std::to_string(version) + ", " + std::to_string(Checkpoint::VERSION) + " expected");
+    }
+    seed = reader.value<std::uint64_t>();
+    random.setState(reader.value<std::array<std::uint64_t, 4>>());
+    auto savedSpecies = std::make_shared<SpeciesRegistry>();
+    savedSpecies->readCheckpoint(reader);
+    species = std::move(savedSpecies);
+    entities.setSpecies(*species);
+    auto savedFighting = std::make_shared<FightingRules>();
+    savedFighting->readCheckpoint(reader);
+    fighting = std::move(savedFighting);
+    entities.setFighting(*fighting);
+    for (int *value : {&width, &height, &quantityOfFood, &epochLength, &epochCounter, &tickCounter, &killedIndividuals, &matingsOccurred}) {
+        *value = reader.value<int>();
+    }
+    if (width <= 0 || height <= 0 || (long long) width * height > INT_MAX) {
+        throw InvalidWorldSizeException(width, height);
+    }
+    readCounts(reader, currentGeneration, INDIVIDUAL_TYPE_BEGIN, species->end());
+    readCounts(reader, survivorMap, INDIVIDUAL_TYPE_BEGIN, species->end());
+    readCounts(reader, fightingStrategyMap, FIGHTING_TYPE_BEGIN, fighting->end());
+
+    entities.setWorldSize(width, height);
+    entities.readCheckpoint(reader);
+    for (EntityStore::Id id = 0; id < entities.size(); ++id) {
+        // the strategy indexes the tables of the rules
+        if (entities.strategy(id) == FIGHTING_TYPE_BEGIN || entities.strategy(id) >= fighting->end()) {
+            throw InvalidCheckpointException("unknown strategy " + std::to_string(entities.strategy(id)));
+        }
+        try {
+            CellFactory::attachView(entities, id);
+        } catch (const InvalidIndividualTypeException &e) {
+            throw InvalidCheckpointException(e.what());
+        }
+    }
+
+    std::vector<EntityStore::Id> ids;
+    reader.array(boardCells, (std::uint64_t) width * height);
+    reader.array(ids, boardCells.size());
+    if (ids.size() != boardCells.size()) {
+        throw InvalidCheckpointException("board cells and their entities of different sizes");
+    }
+    board.reset((std::size_t) width * height);
+    futureBoard.reset((std::size_t) width * height);
+    freeCells.reset(width, height);
+    futureCells.clear();
+    for (std::size_t i = 0; i < boardCells.size(); ++i) {
+        if (boardCells[i] < 0 || boardCells[i] >= width * height || (EntityStore::isIndividual(ids[i]) && ids[i] >= entities.size())) {
+            throw InvalidCheckpointException("board cell " + std::to_string(boardCells[i]) + " out of the world or holding an unknown entity");
+        }
+        board.set(boardCells[i], ids[i]);
+    }
+    // a checkpoint is taken right after a spawn, when every individual stands on its own cell and nowhere else
+    for (std::size_t i = 0; i < boardCells.size(); ++i) {
+        if (EntityStore::isIndividual(ids[i]) && entities.y(ids[i]) * width + entities.x(ids[i]) != boardCells[i]) {
+            throw InvalidCheckpointException("board cell " + std::to_string(boardCells[i]) + " holding an individual that stands elsewhere");
+        }
+    }
+    for (EntityStore::Id id = 0; id < entities.size(); ++id) {
+        if (board[entities.y(id) * width + entities.x(id)] != id) {
+            throw InvalidCheckpointException("individual " + std::to_string(id) + " missing from its cell");
+        }
+    }
+}
+
+std::ostream &operator<<(std::ostream &os, const Simulation &simulation) {
+    os << " width: " << simulation.width << " height: " << simulation.height << " numberOfIndividuals: " << simulation.getTotalIndividuals()
+       << " numberOfFood: " << simulation.quantityOfFood;
+    return os;
+}
@@ -0,0 +1,159 @@
+#ifndef OOP_SIMULATION_H
+#define OOP_SIMULATION_H
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include "Cell.h"
+#include "EntityStore.h"
+#include "ChunkedGrid.h"
+#include "FoodIndex.h"
+#include "FreeCellIndex.h"
+#include "Individual.h"
+#include "Food.h"
+#include "Suitor.h"
+#include "IndividualType.h"
+#include "FightingStrategyType.h"
+#include "FightingOutcome.h"
+#include "EpochStatistics.h"
+#include "SimulationConfig.h"
+#include "BoardSnapshot.h"
+#include "Random.h"
+#include "WorkStealingPool.h"
+#include "PhaseTimers.h"
+
+// the evolution simulation itself, without any rendering
+// can be driven tick by tick (step) by a viewer, or epoch by epoch (runEpoch) when running headless
+class Simulation {
+public:
+    explicit Simulation(const SimulationConfig &config);
+    // resumes a simulation saved by writeCheckpoint, exactly where it stopped; the world, the generation and the seed come from the checkpoint,
+    // only the threads and timePhases of the configuration are used; throws InvalidCheckpointException for a damaged or foreign file
+    Simulation(std::istream &checkpoint, const SimulationConfig &config);
+    // the views in the entity store point back to it, so a simulation cannot be copied
+    Simulation(const Simulation &other) = delete;
+    Simulation& operator=(const Simulation &other) = delete;
+    friend std::ostream &operator<<(std::ostream &os, const Simulation &simulation);
+    // the hot path benchmark times the private steps of a tick one at a time
+    friend class SimulationBench;
+
+    // advances the world by one tick
+    void step();
+    // runs the remaining ticks of the current epoch, then ends it
+    EpochStatistics runEpoch();
+    // removes the individuals that did not eat enough and gathers the statistics of the epoch
+    EpochStatistics endEpoch();
+    // spawns the evolved generation; throws NoSurvivorsException if nobody survived the last epoch
+    void spawnNextGeneration();
+
+    [[nodiscard]] bool isEpochOver() const;
+    [[nodiscard]] int getEpoch() const;
+    [[nodiscard]] int getTick() const;
+    [[nodiscard]] int getWidth() const;
+    [[nodiscard]] int getHeight() const;
+    [[nodiscard]] std::uint64_t getSeed() const;
+    // the species of the configuration, or those saved in the checkpoint
+    [[nodiscard]] const std::shared_ptr<const SpeciesRegistry> &getSpecies() const;
+    // the fighting rules of the configuration, or those saved in the checkpoint
+    [[nodiscard]] const std::shared_ptr<const FightingRules> &getFighting() const;
+    // entity id of every cell, EntityStore::NONE for empty ones
+    [[nodiscard]] const ChunkedGrid<EntityStore::Id> &getBoard() const;
+    // bytes held by the boards and the per-tick indexes, the entities themselves not included
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+    [[nodiscard]] const EntityStore &getEntities() const;
+    // rolling durations of the phases, recorded only when the configuration asked for it
+    [[nodiscard]] const PhaseTimers &getPhaseTimers() const;
+    // cheap enough to be read after every tick
+    [[nodiscard]] TickStatistics getTickStatistics() const;
+    // copies the colors of the board and the position in time into the snapshot, reusing its memory
+    void takeSnapshot(BoardSnapshot &snapshot) const;
+    // saves everything needed to carry on from the current tick: the board, every entity, the counters of the generation and the random state
+    void writeCheckpoint(std::ostream &os) const;
+
+private:
+    // the entity store and the statistics point to both
+    std::shared_ptr<const SpeciesRegistry> species;
+    std::shared_ptr<const FightingRules> fighting;
+    int killedIndividuals = 0;
+    int matingsOccurred = 0;
+    std::unordered_map<IndividualType, int> survivorMap;
+    std::unordered_map<IndividualType, int> currentGeneration;
+    std::unordered_map<FightingStrategyType, int> fightingStrategyMap;
+    EntityStore entities;
+    // both boards only take memory around the occupied cells
+    ChunkedGrid<EntityStore::Id> board{EntityStore::NONE};
+    ChunkedGrid<EntityStore::Id> futureBoard{EntityStore::NONE};
+    // positions written to each buffer, so that recycling a buffer does not touch the whole grid;
+    // boardCells is also how a tick finds the occupied cells without scanning the world
+    std::vector<int> boardCells;
+    std::vector<int> futureCells;
+    // where the food of the current board is, rebuilt at the start of every tick
+    FoodIndex foodIndex;
+    // cells of the future board taken so far in this tick, for placing offspring and displaced individuals
+    FreeCellIndex freeCells;
+    std::uint64_t seed;
+    // every random decision of this simulation is drawn from here, whichever thread runs it
+    RandomEngine random;
+    int width, height;
+    int quantityOfFood;
+    int epochLength;
+    int epochCounter = 0;
+    int tickCounter = 0;
+    // plans the moves of one tile per task
+    WorkStealingPool pool;
+    PhaseTimers timers;
+    // closest food seen by each individual during planning, by entity id, NO_FOOD if it saw none
+    std::vector<int> plannedFood;
+    // positions of the individuals of every tile, by species: bucket b = tile * species->end() + species
+    // owns tileCells[tileStarts[b]] to tileCells[tileStarts[b + 1] - 1]
+    std::vector<int> tileStarts;
+    std::vector<int> tileCells;
+    // tiles with at least one individual, the only ones handed to the pool
+    std::vector<int> busyTiles;
+    // individuals that moved into a cell someone had already taken in this tick, in reading order
+    std::vector<EntityStore::Id> encounters;
+    constexpr static int OFFSPRING_RADIUS = 15;
+    constexpr static int DISPLACEMENT_RADIUS = 5;
+    constexpr static int TILE_SIZE = 32;
+    constexpr static int NO_FOOD = -1;
+
+    static int poolSize(int threads);
+    void readCheckpoint(std::istream &is);
+    void generateCells();
+    // first phase of a tick, in parallel: every individual picks its food or takes its step
+    void planMoves();
+    // traits is the species of the individual, looked up once for the whole loop over the species
+    void planMove(EntityStore::Id id, const Species &traits);
+    [[nodiscard]] int bucketOf(int pos, int tilesX) const;
+    // second phase, in reading order: claims food and settles who gets each free cell, leaving the taken ones to the encounters
+    void resolveMove(EntityStore::Id id);
+    // third phase, in the order they happened: every fight and every courtship of the tick, once all the free cells are settled
+    void resolveEncounters();
+    [[nodiscard]] bool isClaimable(int foodPos) const;
+    void computeFitness();
+    // position of the closest food the individual can claim, std::nullopt if it sees none
+    std::optional<int> findFoodInRange(EntityStore::Id individual, int radius);
+    std::unordered_map<IndividualType, int> computeNewGeneration();
+    void resetBoard();
+    void resetGeneration(std::unordered_map<IndividualType, int> generation);
+    int getTotalIndividuals() const;
+    int getTotalSurvivors() const;
+
+    // writes to the future board, remembering the cell for the next swap
+    void place(int pos, EntityStore::Id id);
+    // makes the future board current and empties the old one for the next tick
+    void swapBoards();
+    void mate(EntityStore::Id individual, EntityStore::Id suitor);
+    // free position of the future board closest to pos, std::nullopt if the square of the given radius is full
+    std::optional<int> findFreeSpot(int pos, int radius);
+    bool produceOffspring(int pos, IndividualType suitorSpecies, IndividualType target);
+    void assertFitnessOfIndividual(EntityStore::Id individual);
+    bool performSuitorCheck(EntityStore::Id individual, EntityStore::Id suitorCandidate);
+    void handleInteraction(EntityStore::Id individual1, EntityStore::Id individual2);
+    void handleFightingOutcome(EntityStore::Id individual1, EntityStore::Id individual2, FightingOutcome fightingOutcome);
+};
+
+#endif //OOP_SIMULATION_H
@@ -0,0 +1,18 @@
+#include "SimulationConfig.h"
+#include "Utils.h"
+
+SimulationConfig promptSimulationConfig(const std::shared_ptr<const SpeciesRegistry> &species) {
+    SimulationConfig config;
+    config.species = species;
+    config.generation[KEYSTONE_TYPE] = promptUser("[YELLOW] Specify the desired number of Keystone's (no special abilities, but can sustain on a small quantity of food):", 0, 600);
+    config.generation[CLAIRVOYANT_TYPE] = promptUser("[BLUE] Specify the desired number of Clairvoyant's (can spot food from afar):", 0, 600);
+    config.generation[REDBULL_TYPE] = promptUser("[RED] Specify the desired number of RedBull's (fast on their feet, but very hungry!)", 0, 600);
+    config.generation[ASCENDANT_TYPE] = promptUser("[CYAN] Specify the desired number of Ascendant's (become much stronger once they encounter food for the first time", 0, 600);
+    config.generation[SUITOR_TYPE] = promptUser("[PINK] Specify the desired number of Suitor's - each Suitor wants to mate with a specific breed of Individuals. The type of Suitor gets chosen randomly at spawn time.",
+                                                0, 600);
+    for (auto type = INDIVIDUAL_TYPE_END; type != species->end(); type = (IndividualType)(type + 1)) {
+        config.generation[type] = promptUser("Specify the desired number of " + (*species)[type].name + "'s:", 0, 600);
+    }
+    config.quantityOfFood = promptUser("[DARK GREEN] Specify the desired quantity of food", 0, 2500);
+    return config;
+}
@@ -0,0 +1,40 @@
+#ifndef OOP_SIMULATIONCONFIG_H
+#define OOP_SIMULATIONCONFIG_H
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include "IndividualType.h"
+#include "SpeciesRegistry.h"
+#include "FightingRules.h"
+
+// everything needed to start a simulation, independently of how it gets displayed
+struct SimulationConfig {
+    // an epoch used to last 2 seconds at 15 frames per second
+    const static int DEFAULT_EPOCH_LENGTH = 30;
+
+    const static int DEFAULT_WIDTH = 200;
+    const static int DEFAULT_HEIGHT = 200;
+
+    int width = DEFAULT_WIDTH;
+    int height = DEFAULT_HEIGHT;
+    // the species that can be spawned, shared by the simulations that use the same species file
+    std::shared_ptr<const SpeciesRegistry> species = SpeciesRegistry::builtIn();
+    // the strategies individuals are born with and how they fight, shared like the species
+    std::shared_ptr<const FightingRules> fighting = FightingRules::builtIn();
+    std::unordered_map<IndividualType, int> generation;
+    int quantityOfFood = 0;
+    int epochLength = DEFAULT_EPOCH_LENGTH;
+    // two simulations with the same seed and configuration evolve identically; picked at random when not set
+    std::optional<std::uint64_t> seed;
+    // threads that plan each tick, 0 for one per hardware thread; the outcome is the same for any value
+    int threads = 0;
+    // keeps rolling durations of the phases of every tick, see Simulation::getPhaseTimers()
+    bool timePhases = false;
+};
+
+// asks for the number of individuals of every species, the ones of the species file after the built-in ones, and the quantity of food
+SimulationConfig promptSimulationConfig(const std::shared_ptr<const SpeciesRegistry> &species = SpeciesRegistry::builtIn());
+
+#endif //OOP_SIMULATIONCONFIG_H
@@ -0,0 +1,200 @@
+#include "SpeciesRegistry.h"
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include "Checkpoint.h"
+#include "ConfigParsing.h"
+#include "Exceptions.h"
+#include "Utils.h"
+
+namespace {
+    // one value for both phases, or the one before and the one after the first meal
+    std::array<int, 2> parsePhases(int lineNumber, const std::string &key, const std::string &text) {
+        auto numbers = parseNumbers<InvalidSpeciesException>(lineNumber, key, text, SpeciesRegistry::MAX_TRAIT);
+        if (numbers.empty() || numbers.size() > 2) {
+            throw InvalidSpeciesException(lineNumber, key + " takes one or two values");
+        }
+        return {numbers.front(), numbers.back()};
+    }
+}
+
+SpeciesRegistry::SpeciesRegistry() {
+    species.resize(INDIVIDUAL_TYPE_END);
+    species[CLAIRVOYANT_TYPE] = {"Clairvoyant", 2, {1, 1}, {5, 5}, Color::Blue};
+    // limited at first, faster and farther seeing once it has eaten
+    species[ASCENDANT_TYPE] = {"Ascendant", 2, {1, 5}, {2, 10}, Color::Cyan};
+    species[KEYSTONE_TYPE] = {"Keystone", 1, {1, 1}, {2, 2}, Color::Yellow};
+    species[SUITOR_TYPE] = {"Suitor", 2, {1, 1}, {2, 2}, Color::Magenta, ANY_MATE};
+    species[REDBULL_TYPE] = {"RedBull", 2, {5, 5}, {2, 2}, Color::Red};
+    listFighters();
+}
+
+SpeciesRegistry::SpeciesRegistry(std::istream &config) : SpeciesRegistry() {
+    // mates may name a species further down the file, they are looked up once everything is read
+    std::vector<std::pair<int, std::string>> mateNames(species.size());
+    std::optional<IndividualType> current;
+    std::string line;
+    for (int lineNumber = 1; std::getline(config, line); ++lineNumber) {
+        line = stripComment(line);
+        if (line.empty()) {
+            continue;
+        }
+        if (auto name = parseSectionName<InvalidSpeciesException>(lineNumber, line)) {
+            if (!isValidConfigName(*name, MAX_NAME_LENGTH)) {
+                throw InvalidSpeciesException(lineNumber, "invalid species name " + *name);
+            }
+            current = find(*name);
+            if (!current) {
+                if ((int) species.size() >= MAX_SPECIES) {
+                    throw InvalidSpeciesException(lineNumber, "more than " + std::to_string(MAX_SPECIES - 1) + " species");
+                }
+                current = end();
+                Species added = species[KEYSTONE_TYPE];
+                added.name = *name;
+                species.push_back(added);
+                mateNames.emplace_back();
+            }
+            continue;
+        }
+        if (!current) {
+            throw InvalidSpeciesException(lineNumber, "expected [name] before the first trait");
+        }
+        auto assignment = splitAssignment(line);
+        if (!assignment) {
+            throw InvalidSpeciesException(lineNumber, "expected key = values");
+        }
+        const auto &[key, values] = *assignment;
+        Species &entry = species[*current];
+        if (key == "hunger") {
+            auto numbers = parseNumbers<InvalidSpeciesException>(lineNumber, key, values, MAX_TRAIT);
+            if (numbers.size() != 1) {
+                throw InvalidSpeciesException(lineNumber, "hunger takes one value");
+            }
+            entry.hunger = numbers[0];
+        } else if (key == "speed") {
+            entry.speed = parsePhases(lineNumber, key, values);
+        } else if (key == "vision") {
+            entry.vision = parsePhases(lineNumber, key, values);
+        } else if (key == "color") {
+            auto numbers = parseNumbers<InvalidSpeciesException>(lineNumber, key, values, INT_MAX);
+            if (numbers.size() != 3 || std::any_of(numbers.begin(), numbers.end(), [](int n) { return n > UINT8_MAX; })) {
+                throw InvalidSpeciesException(lineNumber, "color takes red, green and blue, from 0 to 255");
+            }
+            entry.color = {(std::uint8_t) numbers[0], (std::uint8_t) numbers[1], (std::uint8_t) numbers[2]};
+        } else if (key == "mates") {
+            // the built-in species are created by their own classes, which decide whether they fight
+            if (*current < INDIVIDUAL_TYPE_END) {
+                throw InvalidSpeciesException(lineNumber, "the mates of " + entry.name + " cannot be changed");
+            }
+            mateNames[*current] = {lineNumber, values};
+        } else {
+            throw InvalidSpeciesException(lineNumber, "unknown trait " + key);
+        }
+    }
+    for (auto type = INDIVIDUAL_TYPE_END; type != end(); type = (IndividualType) (type + 1)) {
+        auto [lineNumber, name] = mateNames[type];
+        if (name.empty()) {
+            continue;
+        }
+        auto target = name == "any" ? std::optional<IndividualType>(ANY_MATE) : find(name);
+        if (!target || (*target != ANY_MATE && species[*target].isSuitor())) {
+            throw InvalidSpeciesException(lineNumber, name + " is not a species that fights");
+        }
+        species[type].mates = *target;
+    }
+    listFighters();
+}
+
+const std::shared_ptr<const SpeciesRegistry> &SpeciesRegistry::builtIn() {
+    static const std::shared_ptr<const SpeciesRegistry> registry = std::make_shared<const SpeciesRegistry>();
+    return registry;
+}
+
+std::shared_ptr<const SpeciesRegistry> SpeciesRegistry::load(const std::string &path) {
+    if (path.empty()) {
+        return builtIn();
+    }
+    std::ifstream file(path);
+    if (!file) {
+        throw ResourceLoadException(path);
+    }
+    return std::make_shared<const SpeciesRegistry>(file);
+}
+
+std::optional<IndividualType> SpeciesRegistry::find(const std::string &name) const {
+    // the names are column names as well, where the case is lost
+    for (auto type = (IndividualType) (INDIVIDUAL_TYPE_BEGIN + 1); type != end(); type = (IndividualType) (type + 1)) {
+        if (toColumnName(species[type].name) == toColumnName(name)) {
+            return type;
+        }
+    }
+    return std::nullopt;
+}
+
+void SpeciesRegistry::listFighters() {
+    // the order suitors picked their species in before there was a registry, so that the built-in species evolve as they did
+    fighters = {ASCENDANT_TYPE, REDBULL_TYPE, KEYSTONE_TYPE, CLAIRVOYANT_TYPE};
+    for (auto type = INDIVIDUAL_TYPE_END; type < end(); type = (IndividualType) (type + 1)) {
+        if (!species[type].isSuitor()) {
+            fighters.push_back(type);
+        }
+    }
+}
+
+std::optional<std::string> SpeciesRegistry::findProblem() const {
+    if (species.size() < INDIVIDUAL_TYPE_END || (int) species.size() > MAX_SPECIES) {
+        return std::to_string(species.size()) + " species";
+    }
+    for (auto type = (IndividualType) (INDIVIDUAL_TYPE_BEGIN + 1); type != end(); type = (IndividualType) (type + 1)) {
+        const Species &entry = species[type];
+        if (!isValidConfigName(entry.name, MAX_NAME_LENGTH) || find(entry.name) != type) {
+            return "invalid or repeated species name " + entry.name;
+        }
+        auto [least, most] = std::minmax({entry.hunger, entry.speed[0], entry.speed[1], entry.vision[0], entry.vision[1]});
+        if (least < 0 || most > MAX_TRAIT) {
+            return "trait out of range of " + entry.name;
+        }
+        bool isBuiltInMate = type >= INDIVIDUAL_TYPE_END || entry.mates == (*builtIn())[type].mates;
+        bool isKnownMate = entry.mates == ANY_MATE || (entry.mates < end() && !species[entry.mates].isSuitor());
+        if (!isBuiltInMate || (entry.isSuitor() && !isKnownMate)) {
+            return "invalid mates of " + entry.name;
+        }
+    }
+    return std::nullopt;
+}
+
+void SpeciesRegistry::writeCheckpoint(CheckpointWriter &writer) const {
+    writer.value((std::uint64_t) species.size());
+    for (auto type = (IndividualType) (INDIVIDUAL_TYPE_BEGIN + 1); type != end(); type = (IndividualType) (type + 1)) {
+        const Species &entry = species[type];
+        writer.array(std::vector<char>(entry.name.begin(), entry.name.end()));
+        writer.value(entry.hunger);
+        writer.value(entry.speed);
+        writer.value(entry.vision);
+        writer.value(entry.color);
+        writer.value(entry.mates);
+    }
+}
+
+void SpeciesRegistry::readCheckpoint(CheckpointReader &reader) {
+    auto count = reader.value<std::uint64_t>();
+    if (count < INDIVIDUAL_TYPE_END || count > MAX_SPECIES) {
+        throw InvalidCheckpointException(std::to_string(count) + " species");
+    }
+    species.assign(count, Species());
+    std::vector<char> name;
+    for (auto type = (IndividualType) (INDIVIDUAL_TYPE_BEGIN + 1); type != end(); type = (IndividualType) (type + 1)) {
+        Species &entry = species[type];
+        reader.array(name, MAX_NAME_LENGTH);
+        entry.name.assign(name.begin(), name.end());
+        entry.hunger = reader.value<int>();
+        entry.speed = reader.value<std::array<int, 2>>();
+        entry.vision = reader.value<std::array<int, 2>>();
+        entry.color = reader.value<Color>();
+        entry.mates = reader.value<IndividualType>();
+    }
+    if (auto problem = findProblem()) {
+        throw InvalidCheckpointException(*problem);
+    }
+    listFighters();
+}
@@ -0,0 +1,81 @@
+#ifndef OOP_SPECIESREGISTRY_H
+#define OOP_SPECIESREGISTRY_H
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Color.h"
+#include "IndividualType.h"
+
+class CheckpointWriter;
+class CheckpointReader;
+
+// what sets a species apart; a species changes at most once, when one of its individuals eats for the first time,
+// and the eaten bit of the individual picks which of the two phases it is in
+struct Species {
+    std::string name;
+    // food needed to survive the epoch
+    int hunger = 1;
+    // [0] until the first meal, [1] from then on
+    std::array<int, 2> speed{1, 1};
+    std::array<int, 2> vision{2, 2};
+    Color color = Color::White;
+    // the species its individuals court instead of fighting, INDIVIDUAL_TYPE_BEGIN for a species that fights
+    // and SpeciesRegistry::ANY_MATE for one picked at random among those that fight, for every individual
+    IndividualType mates = INDIVIDUAL_TYPE_BEGIN;
+
+    [[nodiscard]] bool isSuitor() const { return mates != INDIVIDUAL_TYPE_BEGIN; }
+};
+
+// every species of a simulation, in a flat table indexed by IndividualType
+// the built-in species keep their enum values and the ones read from a species file follow from INDIVIDUAL_TYPE_END on,
+// so that a new variant only needs a few lines of configuration and no recompiling
+class SpeciesRegistry {
+public:
+    constexpr static IndividualType ANY_MATE = (IndividualType) UINT8_MAX;
+    // species ids are stored in a byte and ANY_MATE is not one of them
+    constexpr static int MAX_SPECIES = UINT8_MAX - 1;
+    // names are letters, digits and underscores, starting with a letter
+    constexpr static int MAX_NAME_LENGTH = 64;
+    // bound of hunger, speed and vision; keeps a step and the square an individual looks over within an int,
+    // and is already further than the individuals could use on any world the simulation is meant for
+    constexpr static int MAX_TRAIT = 1000;
+
+    // the five species the simulator was written with
+    SpeciesRegistry();
+    // the built-in species changed and extended by a species file: "[name]" starts a species, followed by "key = values" lines
+    // for hunger, speed and vision (one value, or the values before and after the first meal, up to MAX_TRAIT), color (red green blue)
+    // and mates (the name of a species, or "any"); a built-in name changes that species, any other adds one with
+    // the traits of a Keystone; '#' starts a comment; throws InvalidSpeciesException
+    explicit SpeciesRegistry(std::istream &config);
+
+    // shared by every simulation that is not given a species file
+    static const std::shared_ptr<const SpeciesRegistry> &builtIn();
+    // the built-in species for an empty path; throws ResourceLoadException if the file cannot be read
+    static std::shared_ptr<const SpeciesRegistry> load(const std::string &path);
+
+    [[nodiscard]] const Species &operator[](IndividualType type) const { return species[type]; }
+    // one past the last species, the bound of every loop over them
+    [[nodiscard]] IndividualType end() const { return (IndividualType) species.size(); }
+    [[nodiscard]] std::optional<IndividualType> find(const std::string &name) const;
+    // the species that fight, the ones a suitor of ANY_MATE picks from
+    [[nodiscard]] const std::vector<IndividualType> &getFighters() const { return fighters; }
+    void writeCheckpoint(CheckpointWriter &writer) const;
+    // replaces every species with the saved ones; throws InvalidCheckpointException if they do not make sense
+    void readCheckpoint(CheckpointReader &reader);
+
+private:
+    // [INDIVIDUAL_TYPE_BEGIN] is a placeholder, so that the enum values index the table
+    std::vector<Species> species;
+    std::vector<IndividualType> fighters;
+
+    void listFighters();
+    // what the simulation relies on: valid and distinct names, traits from 0 to MAX_TRAIT and known mates; the reason if not
+    [[nodiscard]] std::optional<std::string> findProblem() const;
+};
+
+#endif //OOP_SPECIESREGISTRY_H
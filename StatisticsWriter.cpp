@@ -0,0 +1,62 @@
+#include "StatisticsWriter.h"
+#include <array>
+#include <string>
+#include <utility>
+#include "Utils.h"
+
+namespace {
+    std::vector<std::string> epochColumns(const SpeciesRegistry &species, const FightingRules &fighting) {
+        std::vector<std::string> names = {"epoch"};
+        for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species.end(); type = (IndividualType)(type + 1)) {
+            names.push_back(toColumnName(species[type].name) + "_spawned");
+            names.push_back(toColumnName(species[type].name) + "_survived");
+        }
+        for (auto type = (FightingStrategyType)(FIGHTING_TYPE_BEGIN + 1); type != fighting.end(); type = (FightingStrategyType)(type + 1)) {
+            names.push_back(toColumnName(fighting[type].name) + "_survived");
+        }
+        names.emplace_back("killed");
+        names.emplace_back("matings");
+        return names;
+    }
+}
+
+StatisticsWriter::StatisticsWriter(const std::filesystem::path &directory, bool recordTicks, std::shared_ptr<const SpeciesRegistry> species,
+                                   std::shared_ptr<const FightingRules> fighting)
+        : species(std::move(species)), fighting(std::move(fighting)), epochs(directory / "epochs", epochColumns(*this->species, *this->fighting)) {
+    if (recordTicks) {
+        ticks.emplace(directory / "ticks", std::vector<std::string>{"epoch", "tick", "killed", "matings", "occupied_cells"});
+    }
+}
+
+void StatisticsWriter::recordEpoch(const EpochStatistics &statistics) {
+    row.clear();
+    row.push_back(statistics.epoch);
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != species->end(); type = (IndividualType)(type + 1)) {
+        row.push_back(countOf(statistics.generation, type));
+        row.push_back(countOf(statistics.survivors, type));
+    }
+    for (auto type = (FightingStrategyType)(FIGHTING_TYPE_BEGIN + 1); type != fighting->end(); type = (FightingStrategyType)(type + 1)) {
+        row.push_back(countOf(statistics.fightingStrategySurvivors, type));
+    }
+    row.push_back(statistics.killedIndividuals);
+    row.push_back(statistics.matingsOccurred);
+    epochs.append(row);
+}
+
+void StatisticsWriter::recordTick(const TickStatistics &statistics) {
+    if (ticks) {
+        std::array<std::int64_t, 5> tickRow = {statistics.epoch, statistics.tick, statistics.killedIndividuals, statistics.matingsOccurred, statistics.occupiedCells};
+        ticks->append(tickRow);
+    }
+}
+
+bool StatisticsWriter::isRecordingTicks() const {
+    return ticks.has_value();
+}
+
+void StatisticsWriter::flush() {
+    epochs.flush();
+    if (ticks) {
+        ticks->flush();
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef OOP_STATISTICSWRITER_H
+#define OOP_STATISTICSWRITER_H
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <vector>
+#include "ColumnTable.h"
+#include "EpochStatistics.h"
+
+// keeps the statistics of every epoch, and optionally of every tick, as column tables under one directory:
+// epochs/ holds epoch, <species>_spawned and <species>_survived for every species, <strategy>_survived for every strategy, killed, matings;
+// ticks/ holds epoch, tick, killed, matings, occupied_cells
+class StatisticsWriter {
+public:
+    // one pair of species columns for every species of the registry and one column for every strategy of the rules;
+    // throws StatisticsWriteException if the tables cannot be created, or if the directory holds tables with other columns
+    StatisticsWriter(const std::filesystem::path &directory, bool recordTicks,
+                     std::shared_ptr<const SpeciesRegistry> species = SpeciesRegistry::builtIn(),
+                     std::shared_ptr<const FightingRules> fighting = FightingRules::builtIn());
+
+    void recordEpoch(const EpochStatistics &statistics);
+    // does nothing unless the ticks are recorded
+    void recordTick(const TickStatistics &statistics);
+    [[nodiscard]] bool isRecordingTicks() const;
+    // writes every row recorded so far; throws StatisticsWriteException if they could not be written
+    void flush();
+
+private:
+    std::shared_ptr<const SpeciesRegistry> species;
+    std::shared_ptr<const FightingRules> fighting;
+    ColumnTable epochs;
+    std::optional<ColumnTable> ticks;
+    // reused for every epoch row, the number of columns depends on the species and the strategies
+    std::vector<std::int64_t> row;
+};
+
+#endif //OOP_STATISTICSWRITER_H
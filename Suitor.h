@@ -4,12 +4,14 @@
 #include "Individual.h"
 #include "Utils.h"
 
-template <typename IndividualType>
+template <typename Species>
 class Suitor : public Individual {
 public:
-    Suitor(int x, int y): Individual(x, y, nullptr) {}
-    [[nodiscard]] sf::Color getOwnColor() const override { return sf::Color::Magenta; }
-    [[nodiscard]] int getHunger() const override { return 2; }
+    const static IndividualType TYPE = SUITOR_TYPE;
+    // the species this suitor wants to mate with
+    const static IndividualType TARGET = Species::TYPE;
+
+    Suitor(EntityStore &store, EntityStore::Id id): Individual(store, id) {}
 };
 
 
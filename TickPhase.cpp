@@ -0,0 +1,22 @@
+#include "TickPhase.h"
+
+std::string tickPhaseToString(TickPhase phase) {
+    switch (phase) {
+        case FOOD_SEARCH_PHASE:
+            return "food search";
+        case MOVEMENT_PHASE:
+            return "movement";
+        case INTERACTION_PHASE:
+            return "interactions";
+        case ENCOUNTER_PHASE:
+            return "encounters";
+        case SWAP_PHASE:
+            return "swap";
+        case FITNESS_PHASE:
+            return "fitness";
+        case RENDERING_PHASE:
+            return "rendering";
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef OOP_TICKPHASE_H
+#define OOP_TICKPHASE_H
+
+#include <string>
+
+// the parts of the simulation that are timed separately
+enum TickPhase {
+    TICK_PHASE_BEGIN,
+    // rebuilding the food index at the start of a tick
+    FOOD_SEARCH_PHASE,
+    // planning every individual's move, the food lookups included
+    MOVEMENT_PHASE,
+    // resolving the planned moves in reading order: eating and taking the free cells
+    INTERACTION_PHASE,
+    // fights and matings of the individuals that moved into a taken cell
+    ENCOUNTER_PHASE,
+    SWAP_PHASE,
+    // once per epoch
+    FITNESS_PHASE,
+    // drawing a snapshot, measured by the viewer
+    RENDERING_PHASE,
+    TICK_PHASE_END
+};
+
+std::string tickPhaseToString(TickPhase phase);
+
+#endif //OOP_TICKPHASE_H
@@ -0,0 +1,48 @@
+#ifndef OOP_TRIPLEBUFFER_H
+#define OOP_TRIPLEBUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// hands the latest value from one writer thread to one reader thread without locks
+// the writer fills back() and publishes it, the reader picks up the newest published value whenever it wants;
+// neither ever waits for the other, values the reader did not get to in time are simply skipped
+template <typename T>
+class TripleBuffer {
+public:
+    // slot being filled by the writer; only the writer thread may touch it
+    T &back() { return slots[backIndex]; }
+    // makes the back slot the newest value and takes over the slot that was waiting in the middle
+    void publish();
+    // switches front() to the newest published value; false if nothing was published since the last call
+    bool update();
+    // value the reader is working with; only the reader thread may touch it
+    const T &front() const { return slots[frontIndex]; }
+
+private:
+    // set in middle when it holds a value the reader has not seen yet
+    constexpr static std::uint8_t FRESH = 4;
+    constexpr static std::uint8_t INDEX_MASK = 3;
+
+    std::array<T, 3> slots{};
+    std::atomic<std::uint8_t> middle{1};
+    std::uint8_t backIndex = 0;
+    std::uint8_t frontIndex = 2;
+};
+
+template <typename T>
+void TripleBuffer<T>::publish() {
+    backIndex = middle.exchange(backIndex | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+template <typename T>
+bool TripleBuffer<T>::update() {
+    if ((middle.load(std::memory_order_acquire) & FRESH) == 0) {
+        return false;
+    }
+    frontIndex = middle.exchange(frontIndex, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+}
+
+#endif //OOP_TRIPLEBUFFER_H
@@ -1,9 +1,12 @@
 #include <iostream>
 #include <string>
-#include <random>
-#include <SFML/Graphics/Font.hpp>
+#include <numeric>
+#include <bit>
+#include <algorithm>
+#include <cctype>
 #include "Exceptions.h"
 #include "Utils.h"
+#include "Random.h"
 
 int promptUser(const std::string& message, int mn, int mx) {
     int input;
@@ -14,35 +17,91 @@ int promptUser(const std::string& message, int mn, int mx) {
     return input;
 }
 
-int randomIntegerFromInterval(int mn, int mx) {
-    // generate random integer in interval mn, max using <random>
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> dis(mn, mx);
-    return dis(gen);
-}
+// below this many slots per number a hash lookup per swap costs more than filling the whole interval
+const static int SPARSE_SAMPLING_RATIO = 16;
 
-void initializeFont(sf::Font& font) {
-    if (!font.loadFromFile("assets/RobotoMono-Regular.ttf")) {
-        throw FontLoadingException("assets/RobotoMono-Regular.ttf", "Roboto Mono");
+std::vector<int> generateRandomArray(int size, int mn, int mx) {
+    if ((long long) size * SPARSE_SAMPLING_RATIO < (long long) mx - mn) {
+        return generateRandomArraySparse(size, mn, mx);
     }
+    return generateRandomArrayDense(size, mn, mx);
 }
 
-// generate size distinct random numbers in interval [mn, mx)
 // using the Fisher Yates shuffle algorithm
-std::vector<int> generateRandomArray(int size, int mn, int mx) {
-    std::vector<int> v;
-    for (int i = mn; i < mx; i++) {
-        v.push_back(i);
-    }
+std::vector<int> generateRandomArrayDense(int size, int mn, int mx) {
+    std::vector<int> v(mx - mn);
+    std::iota(v.begin(), v.end(), mn);
+    // draw the random bits for all the swaps at once
+    std::vector<std::uint64_t> bits(size);
+    currentRandomEngine().fill(bits);
     for (int i = 0; i < size; i++) {
-        int j = randomIntegerFromInterval(i, mx - 1);
+        int j = i + (int) RandomEngine::bounded(bits[i], (std::uint32_t) (mx - mn - i));
         std::swap(v[i], v[j]);
     }
     v.resize(size);
     return v;
 }
 
+namespace {
+    // open addressing table of the slots whose number was swapped, sized once so that it is never more than half full
+    class MovedSlots {
+    public:
+        explicit MovedSlots(int size)
+                : shift(64 - std::bit_width((std::size_t) size * 2 + 1)), entries(std::size_t{1} << (64 - shift), {EMPTY, 0}) {}
+
+        // number in the slot, original if the slot was never swapped
+        [[nodiscard]] int get(int slot, int original) const {
+            const Entry &entry = entries[find(slot)];
+            return entry.slot == EMPTY ? original : entry.value;
+        }
+
+        // same, but the slot is added to the table so that its number can be replaced
+        int &at(int slot, int original) {
+            Entry &entry = entries[find(slot)];
+            if (entry.slot == EMPTY) {
+                entry = {slot, original};
+            }
+            return entry.value;
+        }
+
+    private:
+        constexpr static int EMPTY = -1;
+        struct Entry {
+            int slot;
+            int value;
+        };
+        int shift;
+        std::vector<Entry> entries;
+
+        // index of the slot's entry, or of the empty entry where it would go
+        [[nodiscard]] std::size_t find(int slot) const {
+            std::size_t mask = entries.size() - 1;
+            std::size_t k = (std::uint64_t) slot * 0x9E3779B97F4A7C15ULL >> shift;
+            while (entries[k].slot != slot && entries[k].slot != EMPTY) {
+                k = (k + 1) & mask;
+            }
+            return k;
+        }
+    };
+}
+
+// slot k of the interval holds mn + k until a swap moves something else into it; only those slots are stored
+// slot i is never read again once step i has taken its number, so every step adds at most one slot
+std::vector<int> generateRandomArraySparse(int size, int mn, int mx) {
+    std::vector<std::uint64_t> bits(size);
+    currentRandomEngine().fill(bits);
+    MovedSlots moved(size);
+    std::vector<int> v(size);
+    for (int i = 0; i < size; i++) {
+        int j = i + (int) RandomEngine::bounded(bits[i], (std::uint32_t) (mx - mn - i));
+        int valueI = moved.get(i, mn + i);
+        int &atJ = moved.at(j, mn + j);
+        v[i] = atJ;
+        atJ = valueI;
+    }
+    return v;
+}
+
 
 std::string getPercentage(int newStat, int oldStat) {
     if (oldStat == 0) {
@@ -52,20 +111,26 @@ std::string getPercentage(int newStat, int oldStat) {
     }
 }
 
-void checkCoordinates(int x, int y) {
-    if (x < 0 || x >= MAX_X || y < 0 || y >= MAX_Y) {
-        throw InvalidIndividualPositionException(x, y);
-    }
+std::string toColumnName(const std::string &name) {
+    std::string columnName = name;
+    std::transform(columnName.begin(), columnName.end(), columnName.begin(), [](unsigned char c) { return (char) std::tolower(c); });
+    return columnName;
+}
+
+bool isInsideBoard(int x, int y, int width, int height) {
+    return x >= 0 && x < width && y >= 0 && y < height;
 }
 
-void checkCoordinates(int pos) {
-    return checkCoordinates(pos / MAX_X, pos % MAX_X);
+void checkCoordinates(int x, int y, int width, int height) {
+    if (!isInsideBoard(x, y, width, height)) {
+        throw InvalidIndividualPositionException(x, y);
+    }
 }
 
-sf::Color colorMixer(const sf::Color& color1, const sf::Color& color2) {
-    sf::Uint8 red = (color1.r + color2.r) / 2;
-    sf::Uint8 green = (color1.g + color2.g) / 2;
-    sf::Uint8 blue = (color1.b + color2.b) / 2;
+Color colorMixer(const Color& color1, const Color& color2) {
+    std::uint8_t red = (color1.r + color2.r) / 2;
+    std::uint8_t green = (color1.g + color2.g) / 2;
+    std::uint8_t blue = (color1.b + color2.b) / 2;
 
     return {red, green, blue};
 }
\ No newline at end of file
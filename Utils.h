@@ -1,18 +1,34 @@
 #pragma once
 #include <string>
-#include "Game.h"
+#include <unordered_map>
+#include <vector>
+#include "Color.h"
 
 const static int dirX[] = {1, 1, 0, -1, -1, -1, 0, 1};
 const static int dirY[] = {0, 1, 1, 1, 0, -1, -1, -1};
-const static int MAX_X = 200;
-const static int MAX_Y = 200;
+const static int NUMBERS_OF_DIRECTIONS = 8;
+// how far from the edge an individual that walked off the board is put back
 const static int OFFSET = 50;
 
 int promptUser(const std::string& message, int mn, int mx);
-int randomIntegerFromInterval(int mn, int mx);
-void initializeFont(sf::Font& font);
+// size distinct random numbers of [mn, mx), in random order
+// picks whichever of the two versions below is cheaper, they give the same numbers for the same random state
 std::vector<int> generateRandomArray(int size, int mn, int mx);
+// shuffles the start of the whole interval, memory and time follow mx - mn
+std::vector<int> generateRandomArrayDense(int size, int mn, int mx);
+// the same shuffle, remembering only the slots it swapped, memory and time follow size
+std::vector<int> generateRandomArraySparse(int size, int mn, int mx);
 std::string getPercentage(int newStat, int oldStat);
-void checkCoordinates(int x, int y);
-void checkCoordinates(int pos);
-sf::Color colorMixer(const sf::Color &color1, const sf::Color &color2);
\ No newline at end of file
+// the counter of a key, 0 for a key the map does not hold yet
+template <typename Key>
+int countOf(const std::unordered_map<Key, int> &counts, Key key) {
+    auto it = counts.find(key);
+    return it == counts.end() ? 0 : it->second;
+}
+// name in lowercase, as used for parameters and columns ("RedBull" becomes "redbull")
+std::string toColumnName(const std::string &name);
+// non-throwing bounds check, for the places where leaving the board is an ordinary event
+bool isInsideBoard(int x, int y, int width, int height);
+// throws InvalidIndividualPositionException, for positions that should never be outside the board
+void checkCoordinates(int x, int y, int width, int height);
+Color colorMixer(const Color &color1, const Color &color2);
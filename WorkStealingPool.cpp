@@ -0,0 +1,112 @@
+#include "WorkStealingPool.h"
+#include <algorithm>
+#include <utility>
+
+WorkStealingPool::WorkStealingPool(int threads) {
+    threads = std::max(threads, 1);
+    for (int i = 0; i < threads; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (int i = 1; i < threads; ++i) {
+        workers.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    // join before the mutex and the condition variables go away
+    workers.clear();
+}
+
+int WorkStealingPool::getThreadCount() const {
+    return (int) queues.size();
+}
+
+void WorkStealingPool::run(int count, const std::function<void(int)> &newTask) {
+    if (count <= 0) {
+        return;
+    }
+    auto threads = (int) queues.size();
+    for (int i = 0; i < threads; ++i) {
+        std::lock_guard lock(queues[i]->mutex);
+        for (int k = (int) ((long long) count * i / threads); k < (int) ((long long) count * (i + 1) / threads); ++k) {
+            queues[i]->tasks.push_back(k);
+        }
+    }
+    {
+        std::lock_guard lock(mutex);
+        task = &newTask;
+        error = nullptr;
+        busyWorkers = (int) workers.size();
+        batch++;
+    }
+    wake.notify_all();
+
+    drain(0);
+
+    std::unique_lock lock(mutex);
+    done.wait(lock, [this] { return busyWorkers == 0; });
+    task = nullptr;
+    if (error) {
+        std::rethrow_exception(std::exchange(error, nullptr));
+    }
+}
+
+void WorkStealingPool::workerLoop(int self) {
+    std::uint64_t seenBatch = 0;
+    while (true) {
+        {
+            std::unique_lock lock(mutex);
+            wake.wait(lock, [&] { return stopping || batch != seenBatch; });
+            if (stopping) {
+                return;
+            }
+            seenBatch = batch;
+        }
+        drain(self);
+        {
+            std::lock_guard lock(mutex);
+            busyWorkers--;
+        }
+        done.notify_one();
+    }
+}
+
+void WorkStealingPool::drain(int self) {
+    while (auto index = take(self)) {
+        try {
+            (*task)(*index);
+        } catch (...) {
+            std::lock_guard lock(mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+}
+
+std::optional<int> WorkStealingPool::take(int self) {
+    auto threads = (int) queues.size();
+    // own work first, from the front so that neighbouring tasks run one after the other
+    for (int i = 0; i < threads; ++i) {
+        Queue &queue = *queues[(self + i) % threads];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            int index;
+            if (i == 0) {
+                index = queue.tasks.front();
+                queue.tasks.pop_front();
+            } else {
+                // steal from the back, away from where the owner is working
+                index = queue.tasks.back();
+                queue.tasks.pop_back();
+            }
+            return index;
+        }
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,54 @@
+#ifndef OOP_WORKSTEALINGPOOL_H
+#define OOP_WORKSTEALINGPOOL_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// fixed set of threads that run batches of indexed tasks
+// every thread starts on its own contiguous share of the batch and steals from the others once it runs dry,
+// so that uneven tasks (crowded tiles next to empty ones) still keep every thread busy
+class WorkStealingPool {
+public:
+    // the calling thread counts as one of the threads, so a pool of 1 never starts any
+    explicit WorkStealingPool(int threads);
+    WorkStealingPool(const WorkStealingPool &other) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool &other) = delete;
+    ~WorkStealingPool();
+
+    [[nodiscard]] int getThreadCount() const;
+    // runs task(0), ..., task(count - 1) and waits for all of them; the first exception thrown by a task is rethrown here
+    void run(int count, const std::function<void(int)> &task);
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<int> tasks;
+    };
+
+    // one queue per thread, the calling thread owns the first one
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::jthread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(int)> *task = nullptr;
+    std::uint64_t batch = 0;
+    int busyWorkers = 0;
+    bool stopping = false;
+    std::exception_ptr error;
+
+    void workerLoop(int self);
+    // runs tasks until there is nothing left to take from any queue
+    void drain(int self);
+    std::optional<int> take(int self);
+};
+
+#endif //OOP_WORKSTEALINGPOOL_H
@@ -0,0 +1,52 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "BenchmarkFixtures.h"
+#include "Benchmarks.h"
+#include "Exceptions.h"
+
+// every heap allocation of the bench executable goes through here so that the benchmark can count them
+namespace {
+std::atomic<std::size_t> heapAllocations{0};
+}
+
+void *operator new(std::size_t size) {
+    heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+// heap allocations made while spawning each generation, next to the number of views spawned
+// the views come from the entity store's arena, which stops asking for blocks once it has held the largest generation
+void runAllocationBenchmark(BenchmarkResults &results, int repetitions) {
+    SimulationConfig config = standardConfig(200);
+    config.threads = 1;
+
+    Simulation simulation(config);
+    for (int epoch = 1; epoch <= repetitions; ++epoch) {
+        simulation.runEpoch();
+        std::size_t arenaBlocks = simulation.getEntities().getViewArena().getBlockAllocations();
+        std::size_t before = heapAllocations.load(std::memory_order_relaxed);
+        try {
+            simulation.spawnNextGeneration();
+        } catch (const NoSurvivorsException &) {
+            break;
+        }
+        std::size_t spawnAllocations = heapAllocations.load(std::memory_order_relaxed) - before;
+        const EpochArena &arena = simulation.getEntities().getViewArena();
+        std::string benchmarkCase = "epoch=" + std::to_string(epoch);
+        results.record("allocations", benchmarkCase, "views", (double) arena.getObjectCount(), "views");
+        results.record("allocations", benchmarkCase, "spawn_allocations", (double) spawnAllocations, "allocations");
+        results.record("allocations", benchmarkCase, "arena_blocks", (double) (arena.getBlockAllocations() - arenaBlocks), "allocations");
+    }
+}
@@ -0,0 +1,22 @@
+#include "BenchmarkFixtures.h"
+
+SimulationConfig standardConfig(int side) {
+    SimulationConfig config;
+    config.width = side;
+    config.height = side;
+    for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != INDIVIDUAL_TYPE_END; type = (IndividualType)(type + 1)) {
+        config.generation[type] = 600;
+    }
+    config.quantityOfFood = 2500;
+    config.seed = 42;
+    return config;
+}
+
+std::chrono::nanoseconds timeEpoch(Simulation &simulation, int &ticks) {
+    auto start = std::chrono::steady_clock::now();
+    while (!simulation.isEpochOver()) {
+        simulation.step();
+        ticks++;
+    }
+    return std::chrono::steady_clock::now() - start;
+}
@@ -0,0 +1,14 @@
+#ifndef OOP_BENCHMARKFIXTURES_H
+#define OOP_BENCHMARKFIXTURES_H
+
+#include <chrono>
+#include "Simulation.h"
+#include "SimulationConfig.h"
+
+// the board most benchmarks run on: side x side cells, 600 individuals of each built-in species, 2500 food and seed 42,
+// one thread per hardware thread
+SimulationConfig standardConfig(int side);
+// steps the simulation to the end of its epoch, returns the time spent in step() and adds the ticks to the count
+std::chrono::nanoseconds timeEpoch(Simulation &simulation, int &ticks);
+
+#endif //OOP_BENCHMARKFIXTURES_H
@@ -0,0 +1,24 @@
+#include "BenchmarkResults.h"
+
+BenchmarkResults::BenchmarkResults(std::ostream &os, Format format) : os(os), format(format) {
+    if (format == CSV_FORMAT) {
+        os << "benchmark,case,metric,value,unit\n";
+    }
+}
+
+void BenchmarkResults::record(const std::string &benchmark, const std::string &benchmarkCase, const std::string &metric, double value,
+                              const std::string &unit) {
+    // none of the names contain commas or quotes, so they are written as they are
+    switch (format) {
+        case CSV_FORMAT:
+            os << benchmark << "," << benchmarkCase << "," << metric << "," << value << "," << unit << "\n";
+            break;
+        case JSON_FORMAT:
+            os << "{\"benchmark\": \"" << benchmark << "\", \"case\": \"" << benchmarkCase << "\", \"metric\": \"" << metric
+               << "\", \"value\": " << value << ", \"unit\": \"" << unit << "\"}\n";
+            break;
+        default:
+            os << benchmark << " [" << benchmarkCase << "] " << metric << ": " << value << " " << unit << "\n";
+    }
+    os.flush();
+}
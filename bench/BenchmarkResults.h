@@ -0,0 +1,27 @@
+#ifndef OOP_BENCHMARKRESULTS_H
+#define OOP_BENCHMARKRESULTS_H
+
+#include <ostream>
+#include <string>
+
+// where the benchmarks put their measurements
+// every measurement is one record (benchmark, case, metric, value, unit), written as a readable line, a CSV row or a JSON line,
+// so that the numbers of two releases can be compared by a script
+class BenchmarkResults {
+public:
+    enum Format {
+        TEXT_FORMAT,
+        CSV_FORMAT,
+        JSON_FORMAT
+    };
+
+    BenchmarkResults(std::ostream &os, Format format);
+    // the case describes the parameters of the measurement as space separated key=value pairs, e.g. "side=200 fill=0.01"
+    void record(const std::string &benchmark, const std::string &benchmarkCase, const std::string &metric, double value, const std::string &unit);
+
+private:
+    std::ostream &os;
+    Format format;
+};
+
+#endif //OOP_BENCHMARKRESULTS_H
@@ -0,0 +1,18 @@
+#ifndef OOP_BENCHMARKS_H
+#define OOP_BENCHMARKS_H
+
+#include "BenchmarkResults.h"
+
+// each benchmark records its own measurements
+void runTickBenchmark(BenchmarkResults &results, int repetitions);
+void runDispatchBenchmark(BenchmarkResults &results, int repetitions);
+void runFoodSearchBenchmark(BenchmarkResults &results, int repetitions);
+void runScalingBenchmark(BenchmarkResults &results, int repetitions);
+void runWorldSizeBenchmark(BenchmarkResults &results, int repetitions);
+void runAllocationBenchmark(BenchmarkResults &results, int repetitions);
+void runPlacementBenchmark(BenchmarkResults &results, int repetitions);
+void runHotPathBenchmark(BenchmarkResults &results, int repetitions);
+void runCheckpointBenchmark(BenchmarkResults &results, int repetitions);
+void runStatisticsBenchmark(BenchmarkResults &results, int repetitions);
+
+#endif //OOP_BENCHMARKS_H
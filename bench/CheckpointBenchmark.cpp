@@ -0,0 +1,52 @@
+#include <chrono>
+#include <sstream>
+#include <string>
+#include "Benchmarks.h"
+#include "Simulation.h"
+#include "SimulationConfig.h"
+
+namespace {
+    template <typename F>
+    double millisecondsPerCall(int repetitions, F &&body) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repetitions; ++i) {
+            body();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::milli>(elapsed).count() / repetitions;
+    }
+}
+
+// saving and loading a freshly spawned generation, in memory so that the disk does not take part
+void runCheckpointBenchmark(BenchmarkResults &results, int repetitions) {
+    for (int side : {200, 1024, 4096}) {
+        for (double fill : {0.01, 0.1}) {
+            SimulationConfig config;
+            config.width = side;
+            config.height = side;
+            auto occupied = (int) ((double) side * side * fill);
+            for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != INDIVIDUAL_TYPE_END; type = (IndividualType)(type + 1)) {
+                config.generation[type] = occupied / 2 / (INDIVIDUAL_TYPE_END - INDIVIDUAL_TYPE_BEGIN - 1);
+            }
+            config.quantityOfFood = occupied / 2;
+            config.seed = 42;
+            config.threads = 1;
+            Simulation simulation(config);
+
+            std::string saved;
+            double save = millisecondsPerCall(repetitions, [&] {
+                std::ostringstream os;
+                simulation.writeCheckpoint(os);
+                saved = std::move(os).str();
+            });
+            double load = millisecondsPerCall(repetitions, [&] {
+                std::istringstream is(saved);
+                Simulation loaded(is, config);
+            });
+            std::string benchmarkCase = "side=" + std::to_string(side) + " fill=" + std::to_string(fill).substr(0, 4);
+            results.record("checkpoint", benchmarkCase, "size", (double) saved.size() / 1024, "KiB");
+            results.record("checkpoint", benchmarkCase, "save", save, "ms");
+            results.record("checkpoint", benchmarkCase, "load", load, "ms");
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#include <array>
+#include <chrono>
+#include <vector>
+#include "Benchmarks.h"
+#include "CellFactory.h"
+#include "EntityStore.h"
+
+namespace {
+    const int POPULATION = 3000;
+
+    // how the fitness pass used to find out the species of an individual; the strategies have been plain tags ever since fights use a table
+    void classifyWithRtti(Individual &individual, std::array<int, INDIVIDUAL_TYPE_END> &species) {
+        if (dynamic_cast<Keystone *>(&individual)) {
+            species[KEYSTONE_TYPE] += 1;
+        } else if (dynamic_cast<Clairvoyant *>(&individual)) {
+            species[CLAIRVOYANT_TYPE] += 1;
+        } else if (dynamic_cast<RedBull *>(&individual)) {
+            species[REDBULL_TYPE] += 1;
+        } else if (dynamic_cast<Ascendant *>(&individual)) {
+            species[ASCENDANT_TYPE] += 1;
+        } else {
+            species[SUITOR_TYPE] += 1;
+        }
+    }
+
+    // how the encounter handling used to check whether a suitor courts an individual
+    template <typename T>
+    bool checkSuitorWithRtti(Individual &suitor, Individual &individual) {
+        return dynamic_cast<Suitor<T> *>(&suitor) != nullptr && dynamic_cast<T *>(&individual) != nullptr;
+    }
+
+    bool isSuitorMatchWithRtti(Individual &suitor, Individual &individual) {
+        return checkSuitorWithRtti<Clairvoyant>(suitor, individual) || checkSuitorWithRtti<RedBull>(suitor, individual) ||
+               checkSuitorWithRtti<Keystone>(suitor, individual) || checkSuitorWithRtti<Ascendant>(suitor, individual);
+    }
+
+    template <typename F>
+    double nanosecondsPerCall(int repetitions, int calls, F &&body) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repetitions; ++i) {
+            body();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / (1.0 * repetitions * calls);
+    }
+}
+
+// compares RTTI-based classification of individuals with the species tags of the entity store
+void runDispatchBenchmark(BenchmarkResults &results, int repetitions) {
+    EntityStore store;
+    std::vector<EntityStore::Id> ids;
+    for (int i = 0; i < POPULATION; ++i) {
+        auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1 + i % (INDIVIDUAL_TYPE_END - INDIVIDUAL_TYPE_BEGIN - 1));
+        ids.push_back(CellFactory::createIndividual(store, 0, 0, type)->getId());
+    }
+    repetitions *= 100;
+
+    std::array<int, INDIVIDUAL_TYPE_END> species{};
+    double rtti = nanosecondsPerCall(repetitions, POPULATION, [&] {
+        for (auto id : ids) {
+            classifyWithRtti(store.individual(id), species);
+        }
+    });
+    double tags = nanosecondsPerCall(repetitions, POPULATION, [&] {
+        for (auto id : ids) {
+            species[store.species(id)] += 1;
+        }
+    });
+    results.record("dispatch", "check=classify", "dynamic_cast", rtti, "ns/individual");
+    results.record("dispatch", "check=classify", "tags", tags, "ns/individual");
+
+    int matches = 0;
+    double rttiMatch = nanosecondsPerCall(repetitions, POPULATION, [&] {
+        for (std::size_t i = 0; i + 1 < ids.size(); ++i) {
+            matches += isSuitorMatchWithRtti(store.individual(ids[i]), store.individual(ids[i + 1]));
+        }
+    });
+    double tagsMatch = nanosecondsPerCall(repetitions, POPULATION, [&] {
+        for (std::size_t i = 0; i + 1 < ids.size(); ++i) {
+            matches += store.species(ids[i]) == SUITOR_TYPE && store.mateTarget(ids[i]) == store.species(ids[i + 1]);
+        }
+    });
+    results.record("dispatch", "check=suitor", "dynamic_cast", rttiMatch, "ns/encounter");
+    results.record("dispatch", "check=suitor", "tags", tagsMatch, "ns/encounter");
+    // keeps the counts alive so that the loops are not optimized away
+    results.record("dispatch", "check=suitor", "checks", species[KEYSTONE_TYPE] + matches, "checks");
+}
@@ -0,0 +1,82 @@
+#include <chrono>
+#include <optional>
+#include <vector>
+#include "Benchmarks.h"
+#include "ChunkedGrid.h"
+#include "EntityStore.h"
+#include "FoodIndex.h"
+#include "Random.h"
+#include "Utils.h"
+
+namespace {
+    const int SIDE = 200;
+    const int QUERIES = 4096;
+
+    // the square scan the simulation used before the food index
+    std::optional<int> scanForFood(const std::vector<EntityStore::Id> &board, int x, int y, int radius) {
+        for (int j = y - radius; j <= y + radius; ++j) {
+            for (int k = x - radius; k <= x + radius; ++k) {
+                int pos = j * SIDE + k;
+                if (j >= 0 && j < SIDE && k >= 0 && k < SIDE && EntityStore::isFood(board[pos])) {
+                    return pos;
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    template <typename F>
+    double nanosecondsPerQuery(int repetitions, F &&query) {
+        auto start = std::chrono::steady_clock::now();
+        long long found = 0;
+        for (int i = 0; i < repetitions; ++i) {
+            for (int q = 0; q < QUERIES; ++q) {
+                found += query(q).value_or(-1);
+            }
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        // keep the results alive so that the queries are not optimized away
+        if (found == 42) {
+            return 0;
+        }
+        return std::chrono::duration<double, std::nano>(elapsed).count() / (1.0 * repetitions * QUERIES);
+    }
+}
+
+// food lookups on sparse and dense boards, for every vision radius the species use
+void runFoodSearchBenchmark(BenchmarkResults &results, int repetitions) {
+    RandomEngine engine(2023);
+    RandomEngineScope scope(engine);
+
+    std::vector<int> queryX(QUERIES), queryY(QUERIES);
+    for (int q = 0; q < QUERIES; ++q) {
+        queryX[q] = randomIntegerFromInterval(0, SIDE - 1);
+        queryY[q] = randomIntegerFromInterval(0, SIDE - 1);
+    }
+
+    for (int foodCells : {200, 2500, 20000}) {
+        std::vector<EntityStore::Id> board(SIDE * SIDE, EntityStore::NONE);
+        ChunkedGrid<EntityStore::Id> grid(EntityStore::NONE);
+        grid.reset(SIDE * SIDE);
+        std::vector<int> foodPositions = generateRandomArray(foodCells, 0, SIDE * SIDE);
+        for (int pos : foodPositions) {
+            board[pos] = EntityStore::FOOD;
+            grid.set(pos, board[pos]);
+        }
+        FoodIndex index;
+        index.rebuild(grid, foodPositions, SIDE, SIDE);
+
+        // 2 is the default vision, 5 the Clairvoyant's and 10 the Ascendant's once it has eaten
+        for (int radius : {2, 5, 10}) {
+            double scan = nanosecondsPerQuery(repetitions, [&](int q) {
+                return scanForFood(board, queryX[q], queryY[q], radius);
+            });
+            double indexed = nanosecondsPerQuery(repetitions, [&](int q) {
+                return index.find(queryX[q], queryY[q], radius, [](int) { return true; });
+            });
+            std::string benchmarkCase = "side=200 food=" + std::to_string(foodCells) + " radius=" + std::to_string(radius);
+            results.record("food_search", benchmarkCase, "scan", scan, "ns/query");
+            results.record("food_search", benchmarkCase, "index", indexed, "ns/query");
+        }
+    }
+}
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <optional>
+#include <string>
+#include <vector>
+#include "Benchmarks.h"
+#include "Simulation.h"
+#include "SimulationConfig.h"
+#include "Random.h"
+
+// reaches the private steps of a tick, so that each of them can be timed on its own
+class SimulationBench {
+public:
+    explicit SimulationBench(Simulation &simulation) : simulation(simulation) {}
+
+    // what step() does before planning: the occupied cells in reading order and a fresh food index
+    void prepareTick() {
+        std::sort(simulation.boardCells.begin(), simulation.boardCells.end());
+        simulation.foodIndex.rebuild(simulation.board, simulation.boardCells, simulation.width, simulation.height);
+    }
+
+    // copies the current board into the future one, as it is by the end of a crowded tick
+    void mirrorBoard() {
+        for (int pos : simulation.boardCells) {
+            simulation.place(pos, simulation.board[pos]);
+        }
+    }
+
+    [[nodiscard]] std::vector<EntityStore::Id> individuals() const {
+        std::vector<EntityStore::Id> ids;
+        for (int pos : simulation.boardCells) {
+            if (EntityStore::isIndividual(simulation.board[pos])) {
+                ids.push_back(simulation.board[pos]);
+            }
+        }
+        return ids;
+    }
+
+    std::optional<int> findFoodInRange(EntityStore::Id id, int radius) { return simulation.findFoodInRange(id, radius); }
+    std::optional<int> findFreeSpot(int pos) { return simulation.findFreeSpot(pos, Simulation::DISPLACEMENT_RADIUS); }
+    void handleInteraction(EntityStore::Id id1, EntityStore::Id id2) { simulation.handleInteraction(id1, id2); }
+    void computeFitness() { simulation.computeFitness(); }
+    void generateCells() { simulation.generateCells(); }
+    Individual &individual(EntityStore::Id id) { return simulation.entities.individual(id); }
+    RandomEngine &random() { return simulation.random; }
+
+private:
+    Simulation &simulation;
+};
+
+namespace {
+    SimulationConfig makeConfig(int side, double fill) {
+        SimulationConfig config;
+        config.width = side;
+        config.height = side;
+        auto occupied = (int) ((double) side * side * fill);
+        // half of the occupied cells are individuals, spread over the species, the other half food
+        int perSpecies = occupied / 2 / (INDIVIDUAL_TYPE_END - INDIVIDUAL_TYPE_BEGIN - 1);
+        for (auto type = (IndividualType)(INDIVIDUAL_TYPE_BEGIN + 1); type != INDIVIDUAL_TYPE_END; type = (IndividualType)(type + 1)) {
+            config.generation[type] = perSpecies;
+        }
+        config.quantityOfFood = occupied / 2;
+        config.seed = 42;
+        config.threads = 1;
+        // the ticks are timed one after the other, the epoch must not end in the middle
+        config.epochLength = INT_MAX;
+        return config;
+    }
+
+    template <typename F>
+    double nanosecondsPer(int calls, F &&body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / std::max(calls, 1);
+    }
+}
+
+// every step of a tick on its own, then the whole tick, on seeded boards of several sizes and densities
+void runHotPathBenchmark(BenchmarkResults &results, int repetitions) {
+    for (int side : {200, 1024}) {
+        for (double fill : {0.02, 0.1, 0.3}) {
+            SimulationConfig config = makeConfig(side, fill);
+            std::string benchmarkCase = "side=" + std::to_string(side) + " fill=" + std::to_string(fill).substr(0, 4);
+            double generate = 0, food = 0, freeSpot = 0, move = 0, interaction = 0, fitness = 0, tick = 0;
+            long long found = 0;
+
+            for (int i = 0; i < repetitions; ++i) {
+                // a fresh board every time, the steps below change it
+                Simulation simulation(config);
+                SimulationBench bench(simulation);
+                RandomEngineScope scope(bench.random());
+                std::vector<EntityStore::Id> ids = bench.individuals();
+                auto count = (int) ids.size();
+
+                bench.prepareTick();
+                food += nanosecondsPer(count, [&] {
+                    for (auto id : ids) {
+                        found += bench.findFoodInRange(id, bench.individual(id).getVision()).value_or(0);
+                    }
+                });
+                bench.mirrorBoard();
+                freeSpot += nanosecondsPer(count, [&] {
+                    for (auto id : ids) {
+                        found += bench.findFreeSpot(bench.individual(id).getPosition()).value_or(0);
+                    }
+                });
+                interaction += nanosecondsPer(count / 2, [&] {
+                    for (std::size_t k = 0; k + 1 < ids.size(); k += 2) {
+                        bench.handleInteraction(ids[k], ids[k + 1]);
+                    }
+                });
+                move += nanosecondsPer(count, [&] {
+                    for (auto id : ids) {
+                        bench.individual(id).move();
+                    }
+                });
+                fitness += nanosecondsPer(1, [&] {
+                    bench.computeFitness();
+                });
+                generate += nanosecondsPer(1, [&] {
+                    bench.generateCells();
+                });
+                tick += nanosecondsPer(1, [&] {
+                    simulation.step();
+                });
+            }
+
+            results.record("hot_paths", benchmarkCase, "find_food_in_range", food / repetitions, "ns/individual");
+            results.record("hot_paths", benchmarkCase, "find_free_spot", freeSpot / repetitions, "ns/individual");
+            results.record("hot_paths", benchmarkCase, "handle_interaction", interaction / repetitions, "ns/encounter");
+            results.record("hot_paths", benchmarkCase, "move", move / repetitions, "ns/individual");
+            results.record("hot_paths", benchmarkCase, "compute_fitness", fitness / repetitions / 1000, "us");
+            results.record("hot_paths", benchmarkCase, "generate_cells", generate / repetitions / 1000, "us");
+            results.record("hot_paths", benchmarkCase, "tick", tick / repetitions / 1000, "us");
+            // keeps the lookups alive so that they are not optimized away
+            results.record("hot_paths", benchmarkCase, "checksum", (double) (found % 1000), "");
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <vector>
+#include "Benchmarks.h"
+#include "Random.h"
+#include "Utils.h"
+
+namespace {
+    // the dense shuffle is not run past this many cells, it would need 4 bytes for every one of them
+    const long long MAX_DENSE_CELLS = 4096LL * 4096;
+    // nor is anything asked for more positions than this
+    const long long MAX_SAMPLES = 1 << 22;
+
+    template <typename F>
+    double microsecondsPerCall(int repetitions, std::vector<int> &last, F &&sample) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repetitions; ++i) {
+            RandomEngine engine(2023);
+            RandomEngineScope scope(engine);
+            last = sample();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() / repetitions;
+    }
+}
+
+// picking the starting cells of a generation for several board sizes and shares of the board to fill
+void runPlacementBenchmark(BenchmarkResults &results, int repetitions) {
+    for (int side : {200, 1024, 4096, 16384}) {
+        long long cells = (long long) side * side;
+        for (double fill : {0.001, 0.01, 0.1, 0.5}) {
+            auto count = (long long) (cells * fill);
+            if (count > MAX_SAMPLES) {
+                continue;
+            }
+            std::vector<int> sparse, dense;
+            double sparseTime = microsecondsPerCall(repetitions, sparse, [&] {
+                return generateRandomArraySparse((int) count, 0, (int) cells);
+            });
+            std::string benchmarkCase = "side=" + std::to_string(side) + " cells=" + std::to_string(count);
+            results.record("placement", benchmarkCase, "sparse", sparseTime, "us");
+            if (cells <= MAX_DENSE_CELLS) {
+                double denseTime = microsecondsPerCall(repetitions, dense, [&] {
+                    return generateRandomArrayDense((int) count, 0, (int) cells);
+                });
+                results.record("placement", benchmarkCase, "dense", denseTime, "us");
+                results.record("placement", benchmarkCase, "same_cells", sparse == dense, "bool");
+            }
+        }
+    }
+}
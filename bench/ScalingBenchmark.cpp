@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
+#include "BenchmarkFixtures.h"
+#include "Benchmarks.h"
+
+// measures the tick for several thread counts and checks that every one of them ends up with the same board
+void runScalingBenchmark(BenchmarkResults &results, int repetitions) {
+    SimulationConfig config = standardConfig(200);
+
+    auto hardwareThreads = (int) std::max(std::thread::hardware_concurrency(), 1u);
+    std::set<int> threadCounts{1, hardwareThreads};
+    for (int threads = 2; threads <= std::max(hardwareThreads, 4); threads *= 2) {
+        threadCounts.insert(threads);
+    }
+
+    std::vector<EntityStore::Id> reference;
+    double singleThreaded = 0;
+    for (int threads : threadCounts) {
+        config.threads = threads;
+        std::chrono::nanoseconds total{0};
+        int ticks = 0;
+        std::vector<EntityStore::Id> board;
+        for (int i = 0; i < repetitions; ++i) {
+            Simulation simulation(config);
+            total += timeEpoch(simulation, ticks);
+            const auto &grid = simulation.getBoard();
+            board.resize(grid.size());
+            for (std::size_t pos = 0; pos < grid.size(); ++pos) {
+                board[pos] = grid[pos];
+            }
+        }
+        double perTick = std::chrono::duration<double, std::micro>(total).count() / ticks;
+        if (reference.empty()) {
+            reference = board;
+            singleThreaded = perTick;
+        }
+        std::string benchmarkCase = "threads=" + std::to_string(threads) + " available=" + std::to_string(hardwareThreads);
+        results.record("scaling", benchmarkCase, "tick", perTick, "us/tick");
+        results.record("scaling", benchmarkCase, "speedup", singleThreaded / perTick, "x");
+        results.record("scaling", benchmarkCase, "same_board", board == reference, "bool");
+    }
+}
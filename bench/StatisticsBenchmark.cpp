@@ -0,0 +1,31 @@
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include "Benchmarks.h"
+#include "StatisticsWriter.h"
+
+// cost of recording the statistics of a tick, files included, for runs of several lengths
+void runStatisticsBenchmark(BenchmarkResults &results, int repetitions) {
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "oop_statistics_bench";
+    for (int rows : {10000, 1000000}) {
+        double total = 0;
+        for (int i = 0; i < repetitions; ++i) {
+            std::filesystem::remove_all(directory);
+            auto start = std::chrono::steady_clock::now();
+            {
+                StatisticsWriter writer(directory, true);
+                TickStatistics statistics;
+                for (int row = 0; row < rows; ++row) {
+                    statistics.tick = row;
+                    statistics.occupiedCells = row % 1000;
+                    writer.recordTick(statistics);
+                }
+                writer.flush();
+            }
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            total += std::chrono::duration<double, std::nano>(elapsed).count() / rows;
+        }
+        results.record("statistics", "rows=" + std::to_string(rows), "record_tick", total / repetitions, "ns/row");
+    }
+    std::filesystem::remove_all(directory);
+}
@@ -0,0 +1,33 @@
+#include <chrono>
+#include "BenchmarkFixtures.h"
+#include "Benchmarks.h"
+
+namespace {
+    // a fresh simulation of the config, timed over its first epoch
+    std::chrono::nanoseconds runEpoch(const SimulationConfig &config, int &ticks) {
+        Simulation simulation(config);
+        return timeEpoch(simulation, ticks);
+    }
+}
+
+// measures the cost of Simulation::step() on a 200x200 board with 3000 individuals, with and without the phase timers
+// the two runs alternate, so that the machine's ups and downs hit both of them alike
+void runTickBenchmark(BenchmarkResults &results, int repetitions) {
+    SimulationConfig config = standardConfig(200);
+    SimulationConfig timedConfig = config;
+    timedConfig.timePhases = true;
+
+    std::chrono::nanoseconds plain{0}, timed{0};
+    int ticks = 0, timedTicks = 0;
+    for (int i = 0; i < repetitions; ++i) {
+        plain += runEpoch(config, ticks);
+        timed += runEpoch(timedConfig, timedTicks);
+    }
+    double plainPerTick = std::chrono::duration<double, std::micro>(plain).count() / ticks;
+    double timedPerTick = std::chrono::duration<double, std::micro>(timed).count() / timedTicks;
+
+    const std::string benchmarkCase = "side=200 individuals=3000 food=2500";
+    results.record("tick", benchmarkCase, "plain", plainPerTick, "us/tick");
+    results.record("tick", benchmarkCase, "timed", timedPerTick, "us/tick");
+    results.record("tick", benchmarkCase, "timer_overhead", (timedPerTick / plainPerTick - 1) * 100, "%");
+}
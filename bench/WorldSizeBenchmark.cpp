@@ -0,0 +1,27 @@
+#include <algorithm>
+#include <chrono>
+#include "BenchmarkFixtures.h"
+#include "Benchmarks.h"
+
+// same population on bigger and bigger worlds: tick time and memory should follow the population, not the area
+void runWorldSizeBenchmark(BenchmarkResults &results, int repetitions) {
+    for (int side : {200, 1024, 4096}) {
+        SimulationConfig config = standardConfig(side);
+        config.threads = 1;
+
+        std::chrono::nanoseconds total{0};
+        int ticks = 0;
+        std::size_t memory = 0;
+        for (int i = 0; i < repetitions; ++i) {
+            Simulation simulation(config);
+            total += timeEpoch(simulation, ticks);
+            memory = std::max(memory, simulation.getMemoryUsage());
+        }
+        // two boards, the per-cell food plan and the food bitmap, as they would take if they were stored dense
+        double denseBytes = (double) side * side * (4 + 4 + 4 + 0.125);
+        std::string benchmarkCase = "side=" + std::to_string(side) + " individuals=3000 food=2500";
+        results.record("world_size", benchmarkCase, "tick", std::chrono::duration<double, std::micro>(total).count() / ticks, "us/tick");
+        results.record("world_size", benchmarkCase, "memory", memory / 1024.0, "KiB");
+        results.record("world_size", benchmarkCase, "dense_memory", denseBytes / 1024, "KiB");
+    }
+}
@@ -0,0 +1,37 @@
+#include <iostream>
+#include <string>
+#include <utility>
+#include "Benchmarks.h"
+#include "Logger.h"
+
+// usage: bench [repetitions] [text|csv|json] [benchmark]
+// runs every benchmark, or only the named one; csv and json write one record per measurement, for comparing releases
+int main(int argc, char *argv[]) {
+    int repetitions = argc > 1 ? std::stoi(argv[1]) : 20;
+    std::string format = argc > 2 ? argv[2] : "text";
+    std::string only = argc > 3 ? argv[3] : "";
+
+    // the events of the simulation would only add noise to the measurements
+    Logger::getInstance().setLevel(ERROR_LEVEL);
+    BenchmarkResults results(std::cout, format == "csv" ? BenchmarkResults::CSV_FORMAT
+                                        : format == "json" ? BenchmarkResults::JSON_FORMAT : BenchmarkResults::TEXT_FORMAT);
+
+    const std::pair<std::string, void (*)(BenchmarkResults &, int)> benchmarks[] = {
+            {"tick", runTickBenchmark},
+            {"dispatch", runDispatchBenchmark},
+            {"food_search", runFoodSearchBenchmark},
+            {"scaling", runScalingBenchmark},
+            {"world_size", runWorldSizeBenchmark},
+            {"allocations", runAllocationBenchmark},
+            {"placement", runPlacementBenchmark},
+            {"hot_paths", runHotPathBenchmark},
+            {"checkpoint", runCheckpointBenchmark},
+            {"statistics", runStatisticsBenchmark},
+    };
+    for (const auto &[name, run] : benchmarks) {
+        if (only.empty() || only == name) {
+            run(results, repetitions);
+        }
+    }
+    return 0;
+}
@@ -1,6 +1,20 @@
 #include "Game.h"
+#include "Exceptions.h"
+#include "Logger.h"
 
-int main() {
-    Game::getInstance().run();
+// usage: oop [species file] [fighting file]
+int main(int argc, char *argv[]) {
+    try {
+        Game::getInstance(argc > 1 ? argv[1] : "", argc > 2 ? argv[2] : "").run();
+    } catch (const InvalidSpeciesException &e) {
+        logError(e.what());
+        return 1;
+    } catch (const InvalidFightingRulesException &e) {
+        logError(e.what());
+        return 1;
+    } catch (const ResourceLoadException &e) {
+        logError(e.what());
+        return 1;
+    }
     return 0;
 }
@@ -0,0 +1,157 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include "Simulation.h"
+#include "SimulationConfig.h"
+#include "Exceptions.h"
+#include "Logger.h"
+#include "StatisticsWriter.h"
+
+namespace {
+    // written next to the old checkpoint and renamed over it, which replaces the file atomically, so that stopping the run midway
+    // never leaves half a file; if anything fails the old checkpoint stays as it was
+    void saveCheckpoint(const Simulation &simulation, const std::string &checkpointPath) {
+        std::string temporaryPath = checkpointPath + ".tmp";
+        std::error_code error;
+        {
+            std::ofstream checkpoint(temporaryPath, std::ios::binary | std::ios::trunc);
+            simulation.writeCheckpoint(checkpoint);
+            // closing flushes what is left, a full disk shows up here at the latest
+            checkpoint.close();
+            if (!checkpoint) {
+                logError("Failed to write the checkpoint to ", temporaryPath, ", keeping the previous one");
+                std::filesystem::remove(temporaryPath, error);
+                return;
+            }
+        }
+        std::filesystem::rename(temporaryPath, checkpointPath, error);
+        if (error) {
+            logError("Failed to replace the checkpoint ", checkpointPath, ": ", error.message(), ", keeping the previous one");
+            std::filesystem::remove(temporaryPath, error);
+        }
+    }
+}
+
+// runs the simulation without a window, as fast as the CPU allows
+// usage: headless [number of epochs] [seed] [threads] [width] [height] [timings file] [checkpoint file] [statistics directory] [ticks]
+// [species file] [fighting file], with the same input as the windowed game on stdin
+// the timings of the phases are written to the timings file at the end of every epoch, as JSON lines if its name ends in .json, as CSV otherwise
+// the simulation is saved to the checkpoint file whenever a new generation is spawned; if the file exists, the run resumes from it instead of reading stdin
+// and carries on until the number of epochs is reached
+// the statistics of every epoch are appended to column tables in the statistics directory, those of every tick as well when followed by "ticks"
+// the species file adds species to the built-in ones or changes them, see SpeciesRegistry, and the fighting file does the same for the strategies,
+// see FightingRules; a resumed run keeps the species and the strategies of its checkpoint
+int main(int argc, char *argv[]) {
+    int epochs = argc > 1 ? std::stoi(argv[1]) : 1;
+    std::string checkpointPath = argc > 7 ? argv[7] : "";
+    std::ifstream savedCheckpoint;
+    if (!checkpointPath.empty()) {
+        savedCheckpoint.open(checkpointPath, std::ios::binary);
+    }
+    SimulationConfig config;
+    try {
+        if (!savedCheckpoint.is_open()) {
+            // both files are read before any prompt, so that a mistake in them shows up right away
+            auto species = SpeciesRegistry::load(argc > 10 ? argv[10] : "");
+            auto fighting = FightingRules::load(argc > 11 ? argv[11] : "");
+            config = promptSimulationConfig(species);
+            config.fighting = fighting;
+        }
+    } catch (const InvalidSpeciesException &e) {
+        logError(e.what());
+        return 1;
+    } catch (const InvalidFightingRulesException &e) {
+        logError(e.what());
+        return 1;
+    } catch (const ResourceLoadException &e) {
+        logError(e.what());
+        return 1;
+    }
+    if (argc > 2) {
+        config.seed = std::stoull(argv[2]);
+    }
+    if (argc > 3) {
+        config.threads = std::stoi(argv[3]);
+    }
+    if (argc > 5) {
+        config.width = std::stoi(argv[4]);
+        config.height = std::stoi(argv[5]);
+    }
+    std::ofstream timings;
+    bool isJson = false;
+    // "" skips the timings, to reach the arguments after them
+    if (argc > 6 && argv[6][0] != '\0') {
+        std::string path = argv[6];
+        timings.open(path);
+        if (!timings) {
+            logError("Failed to open the timings file ", path);
+            return 1;
+        }
+        isJson = path.ends_with(".json");
+        config.timePhases = true;
+        if (!isJson) {
+            PhaseTimers::writeCsvHeader(timings);
+        }
+    }
+    try {
+        std::unique_ptr<Simulation> loaded = savedCheckpoint.is_open() ? std::make_unique<Simulation>(savedCheckpoint, config)
+                                                                       : std::make_unique<Simulation>(config);
+        Simulation &simulation = *loaded;
+        std::optional<StatisticsWriter> statisticsWriter;
+        if (argc > 8) {
+            statisticsWriter.emplace(argv[8], argc > 9 && std::string(argv[9]) == "ticks", simulation.getSpecies(), simulation.getFighting());
+        }
+        // the simulation's events go through the logger's thread, flushing it keeps them in place around what is written here
+        Logger &logger = Logger::getInstance();
+        logger.flush();
+        std::cout << "Seed: " << simulation.getSeed() << "\n";
+        while (simulation.getEpoch() < epochs) {
+            logger.flush();
+            std::cout << "Epoch " << simulation.getEpoch() + 1 << ":\n";
+            while (!simulation.isEpochOver()) {
+                simulation.step();
+                if (statisticsWriter) {
+                    statisticsWriter->recordTick(simulation.getTickStatistics());
+                }
+            }
+            EpochStatistics statistics = simulation.endEpoch();
+            logger.flush();
+            std::cout << statistics;
+            if (statisticsWriter) {
+                statisticsWriter->recordEpoch(statistics);
+                // on disk before the checkpoint of the next epoch, so that a resumed run appends right after them
+                statisticsWriter->flush();
+            }
+            if (timings.is_open()) {
+                if (isJson) {
+                    simulation.getPhaseTimers().writeJson(timings, statistics.epoch);
+                } else {
+                    simulation.getPhaseTimers().writeCsv(timings, statistics.epoch);
+                }
+            }
+            try {
+                simulation.spawnNextGeneration();
+            } catch (const NoSurvivorsException &e) {
+                logInfo(e.what());
+                logInfo("Game over!");
+                break;
+            }
+            if (!checkpointPath.empty()) {
+                saveCheckpoint(simulation, checkpointPath);
+            }
+        }
+    } catch (const InvalidWorldSizeException &e) {
+        logError(e.what());
+        return 1;
+    } catch (const InvalidCheckpointException &e) {
+        logError(e.what());
+        return 1;
+    } catch (const StatisticsWriteException &e) {
+        logError(e.what());
+        return 1;
+    }
+    return 0;
+}
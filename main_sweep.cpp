@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "ParameterSweep.h"
+#include "WorkStealingPool.h"
+#include "Exceptions.h"
+#include "Logger.h"
+
+// runs a grid of configurations side by side, without a window, and writes one CSV row per run and epoch
+// usage: sweep grid.txt [output.csv] [threads] [species file] [fighting file]; the rows go to stdout when no output file is given
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: sweep grid.txt [output.csv] [threads] [species file] [fighting file]\n";
+        return 1;
+    }
+    std::ifstream gridFile(argv[1]);
+    if (!gridFile) {
+        std::cerr << "Cannot open " << argv[1] << "\n";
+        return 1;
+    }
+    int threads = argc > 3 ? std::stoi(argv[3]) : (int) std::max(1u, std::thread::hardware_concurrency());
+    // the events of hundreds of runs interleaved would be noise, only the failures are worth seeing
+    Logger::getInstance().setLevel(WARNING_LEVEL);
+    try {
+        ParameterSweep sweep(gridFile, SpeciesRegistry::load(argc > 4 ? argv[4] : ""), FightingRules::load(argc > 5 ? argv[5] : ""));
+        std::ofstream outputFile;
+        if (argc > 2) {
+            outputFile.open(argv[2]);
+        }
+        std::ostream &output = outputFile.is_open() ? outputFile : std::cout;
+        WorkStealingPool pool(threads);
+        sweep.writeHeader(output);
+        sweep.run(pool, output);
+    } catch (const InvalidSweepException &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    } catch (const InvalidSpeciesException &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    } catch (const InvalidFightingRulesException &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    } catch (const ResourceLoadException &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    Logger::getInstance().flush();
+    return 0;
+}